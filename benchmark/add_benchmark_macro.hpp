@@ -1,13 +1,14 @@
 #pragma once
 
-#include <map>
 #include <optional>
+#include <unordered_map>
 #include <betterstring/string_view.hpp>
+#include <betterstring/hash.hpp>
 #include <nanobench.h>
 
 class register_benchmark {
     using benchmark_fn_type = void(*)(ankerl::nanobench::Bench&, const std::vector<bs::string_view>&);
-    inline static std::map<bs::string_view, benchmark_fn_type> benchmark_registry;
+    inline static std::unordered_map<bs::string_view, benchmark_fn_type, bs::hash<bs::string_view>> benchmark_registry;
 public:
     register_benchmark(const char* benchmark_name, const benchmark_fn_type benchmark_fn) {
         const auto benchmark_name_str = bs::string_view{benchmark_name, bs::strlen(benchmark_name)};
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "../add_benchmark_macro.hpp"
+#include <betterstring/allocators.hpp>
+#include <betterstring/string.hpp>
+#include <fmt/format.h>
+
+#include <vector>
+
+template<class Alloc>
+struct benchmark_allocator_traits : bs::char_traits<char> {
+    using allocator_type = Alloc;
+};
+
+template<class String, class Reset>
+static void run_string_allocation_benchmark(ankerl::nanobench::Bench& bench, const char* const name, const std::vector<std::size_t>& lengths, const std::size_t strings_count, Reset reset) {
+    const std::vector<char> source(lengths.back(), 'x');
+
+    std::vector<String> strings;
+    strings.reserve(strings_count);
+    bench.run(name, [&]() {
+        for (std::size_t i = 0; i < strings_count; ++i) {
+            const std::size_t length = lengths[i % lengths.size()];
+            String& str = strings.emplace_back(source.data(), length / 2);
+            str.append(source.data(), length - length / 2);
+        }
+        bench.doNotOptimizeAway(strings.data());
+        strings.clear();
+        reset();
+    });
+}
+
+ADD_BENCHMARK("string_allocators") {
+    using ankerl::nanobench::Rng;
+
+    const std::size_t strings_count = 1000;
+    const std::size_t max_length = 4096;
+
+    Rng rng;
+    std::vector<std::size_t> lengths(strings_count);
+    for (std::size_t& length : lengths) {
+        length = 24 + rng.bounded(max_length - 24);
+    }
+    lengths.push_back(max_length);
+
+    bench.title(fmt::format("bs::stringt allocation ({} strings, length 24..{})", strings_count, max_length));
+    bench.relative(true);
+
+    using default_string = bs::string;
+    using monotonic_string = bs::stringt<benchmark_allocator_traits<bs::monotonic_allocator<char, 32>>>;
+    using pool_string = bs::stringt<benchmark_allocator_traits<bs::pool_allocator<char, 32>>>;
+    using cache_string = bs::stringt<benchmark_allocator_traits<bs::thread_cache_allocator<char, 32>>>;
+
+    const auto no_reset = []() {};
+    // the arena is released in bulk after each batch of strings is destroyed
+    const auto release_arena = []() { monotonic_string::allocator_type::resource().release(); };
+
+    bench.context("length", "default");
+    run_string_allocation_benchmark<default_string>(bench, "aligned_allocator", lengths, strings_count, no_reset);
+    bench.context("length", "monotonic");
+    run_string_allocation_benchmark<monotonic_string>(bench, "monotonic_allocator", lengths, strings_count, release_arena);
+    bench.context("length", "pool");
+    run_string_allocation_benchmark<pool_string>(bench, "pool_allocator", lengths, strings_count, no_reset);
+    bench.context("length", "thread cache");
+    run_string_allocation_benchmark<cache_string>(bench, "thread_cache_allocator", lengths, strings_count, no_reset);
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "../add_benchmark_macro.hpp"
+#include <betterstring/hash.hpp>
+#include <fmt/format.h>
+
+#include <array>
+#include <functional>
+#include <string>
+#include <string_view>
+
+ADD_BENCHMARK("hash") {
+    using ankerl::nanobench::Rng;
+
+    const std::array<std::size_t, 9> lengths{0, 3, 8, 16, 32, 64, 256, 1024, 4096};
+    Rng rng;
+    std::string text(lengths.back(), '\0');
+    for (char& ch : text) {
+        ch = static_cast<char>('A' + rng.bounded(58));
+    }
+
+    for (const std::size_t length : lengths) {
+        const bs::string_view str(text.data(), length);
+        const std::string_view std_str(text.data(), length);
+        bench.title(fmt::format("hash of a string of length {}", length));
+        bench.relative(true);
+        bench.context("length", fmt::format("{}", length));
+        if (length != 0) {
+            bench.batch(length).unit("byte");
+        }
+
+        bench.run("std::hash<std::string_view>", [&] {
+            bench.doNotOptimizeAway(std::hash<std::string_view>{}(std_str));
+        });
+        bench.run("bs::hash<bs::string_view>", [&] {
+            bench.doNotOptimizeAway(bs::hash<bs::string_view>{}(str));
+        });
+        bench.run("bs::ascii_icase_hash<bs::string_view>", [&] {
+            bench.doNotOptimizeAway(bs::ascii_icase_hash<bs::string_view>{}(str));
+        });
+    }
+}
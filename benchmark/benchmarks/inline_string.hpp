@@ -0,0 +1,59 @@
+#pragma once
+
+#include "../add_benchmark_macro.hpp"
+#include <betterstring/inline_string.hpp>
+#include <betterstring/string.hpp>
+#include <fmt/format.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+ADD_BENCHMARK("inline_string") {
+    using ankerl::nanobench::Rng;
+
+    constexpr std::size_t field_count = 1024;
+    const std::array<std::size_t, 4> lengths{8, 24, 48, 64};
+    Rng rng;
+    std::string text(field_count + lengths.back(), '\0');
+    for (char& ch : text) {
+        ch = static_cast<char>('a' + rng.bounded(26));
+    }
+
+    for (const std::size_t length : lengths) {
+        std::vector<bs::string_view> fields;
+        for (std::size_t i = 0; i < field_count; ++i) {
+            fields.emplace_back(text.data() + i, length);
+        }
+
+        bench.title(fmt::format("store {} fields of length {}", field_count, length));
+        bench.relative(true);
+        bench.context("length", fmt::format("{}", length));
+        bench.batch(field_count).unit("field");
+
+        bench.run("std::string", [&] {
+            std::vector<std::string> stored;
+            stored.reserve(field_count);
+            for (const bs::string_view field : fields) {
+                stored.emplace_back(field.data(), field.size());
+            }
+            bench.doNotOptimizeAway(stored.data());
+        });
+        bench.run("bs::string", [&] {
+            std::vector<bs::string> stored;
+            stored.reserve(field_count);
+            for (const bs::string_view field : fields) {
+                stored.emplace_back(field);
+            }
+            bench.doNotOptimizeAway(stored.data());
+        });
+        bench.run("bs::inline_string<64>", [&] {
+            std::vector<bs::inline_string<64>> stored;
+            stored.reserve(field_count);
+            for (const bs::string_view field : fields) {
+                stored.emplace_back(field);
+            }
+            bench.doNotOptimizeAway(stored.data());
+        });
+    }
+}
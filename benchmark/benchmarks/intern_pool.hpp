@@ -0,0 +1,123 @@
+#pragma once
+
+#include "../add_benchmark_macro.hpp"
+#include <betterstring/intern_pool.hpp>
+#include <betterstring/parallel.hpp>
+#include <betterstring/string.hpp>
+#include <fmt/format.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// the names of the fields in the ingested records, few distinct names repeated many times
+static std::vector<std::string> benchmark_field_names(const std::size_t count, const std::size_t distinct) {
+    ankerl::nanobench::Rng rng;
+    std::vector<std::string> names;
+    names.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::uint32_t id = rng.bounded(static_cast<std::uint32_t>(distinct));
+        names.push_back(fmt::format("{}.field_{}", id % 7 == 0 ? "metadata.labels" : "span", id));
+    }
+    return names;
+}
+
+ADD_BENCHMARK("intern_pool_footprint") {
+    const std::size_t count = 1000000;
+    const std::size_t distinct = 4000;
+    const std::vector<std::string> names = benchmark_field_names(count, distinct);
+
+    std::size_t strings_bytes = 0;
+    {
+        std::vector<bs::string> strings;
+        strings.reserve(count);
+        for (const std::string& name : names) {
+            const bs::string& str = strings.emplace_back(name.data(), name.size());
+            strings_bytes += sizeof(bs::string) + (str.size() > 23 ? str.capacity() : 0);
+        }
+    }
+    std::size_t pool_bytes = 0;
+    {
+        bs::intern_pool pool;
+        std::vector<bs::intern_handle> handles;
+        handles.reserve(count);
+        for (const std::string& name : names) {
+            handles.push_back(pool.intern(bs::string_view(name.data(), name.size())));
+        }
+        pool_bytes = pool.bytes_reserved() + handles.size() * sizeof(bs::intern_handle);
+    }
+    fmt::println(stderr, "{} strings ({} distinct): bs::string {} bytes, bs::intern_pool with handles {} bytes ({:.2f}x)\n",
+        count, distinct, strings_bytes, pool_bytes, double(strings_bytes) / double(pool_bytes));
+
+    bench.title("interning of the field names");
+    bench.relative(true);
+    bench.context("length", fmt::format("{} distinct", distinct));
+    bench.minEpochIterations(1);
+    bench.batch(count).unit("string");
+    bench.run("std::vector<bs::string>", [&] {
+        std::vector<bs::string> strings;
+        strings.reserve(count);
+        for (const std::string& name : names) {
+            strings.emplace_back(name.data(), name.size());
+        }
+        bench.doNotOptimizeAway(strings.size());
+    });
+    bench.run("bs::intern_pool", [&] {
+        bs::intern_pool pool;
+        std::vector<bs::intern_handle> handles;
+        handles.reserve(count);
+        for (const std::string& name : names) {
+            handles.push_back(pool.intern(bs::string_view(name.data(), name.size())));
+        }
+        bench.doNotOptimizeAway(handles.size());
+    });
+}
+
+ADD_BENCHMARK("intern_pool_lookup") {
+    const std::size_t count = 1000000;
+    const std::size_t distinct = 4000;
+    const std::vector<std::string> names = benchmark_field_names(count, distinct);
+
+    std::unordered_set<std::string> set(names.begin(), names.end());
+    bs::intern_pool pool;
+    for (const std::string& name : names) {
+        pool.intern(bs::string_view(name.data(), name.size()));
+    }
+
+    bench.title("lookup of the interned field names");
+    bench.relative(true);
+    bench.context("length", fmt::format("{} distinct", distinct));
+    bench.minEpochIterations(1);
+    bench.batch(count).unit("lookup");
+    bench.run("std::unordered_set<std::string>::find", [&] {
+        std::size_t found = 0;
+        for (const std::string& name : names) {
+            found += set.find(name) != set.end();
+        }
+        bench.doNotOptimizeAway(found);
+    });
+    bench.run("bs::intern_pool::intern (1 thread)", [&] {
+        std::uint32_t sum = 0;
+        for (const std::string& name : names) {
+            sum += pool.intern(bs::string_view(name.data(), name.size())).value();
+        }
+        bench.doNotOptimizeAway(sum);
+    });
+
+    // every thread interns its part of the names, the pool is shared
+    const std::size_t max_threads = bs::par::thread_pool::default_concurrency();
+    for (std::size_t threads = 2; threads <= max_threads; threads *= 2) {
+        bs::par::thread_pool executor(threads);
+        bench.run(fmt::format("bs::intern_pool::intern ({} threads)", threads), [&] {
+            const std::size_t part = (count + threads - 1) / threads;
+            executor.bulk_execute(threads, [&](const std::size_t thread) {
+                std::uint32_t sum = 0;
+                for (std::size_t i = thread * part; i < count && i < (thread + 1) * part; ++i) {
+                    sum += pool.intern(bs::string_view(names[i].data(), names[i].size())).value();
+                }
+                bench.doNotOptimizeAway(sum);
+            });
+        });
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "../add_benchmark_macro.hpp"
+#include <betterstring/io_slices.hpp>
+#include <betterstring/string.hpp>
+#include <fmt/format.h>
+
+#include <array>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <unistd.h>
+
+ADD_BENCHMARK("io_slices") {
+    const std::string path = (std::filesystem::temp_directory_path() / "betterstring_io_slices_benchmark.txt").string();
+    const int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    const std::array<std::size_t, 3> fragment_sizes{16, 256, 4096};
+    constexpr std::size_t fragment_count = 256;
+
+    for (const std::size_t fragment_size : fragment_sizes) {
+        std::vector<bs::string> fragments;
+        for (std::size_t i = 0; i < fragment_count; ++i) {
+            const std::string text = fmt::format("{:>{}}", i, fragment_size);
+            fragments.push_back(bs::string(bs::string_view(text.data(), text.size())));
+        }
+
+        bench.title(fmt::format("write {} fragments of length {} to a file", fragment_count, fragment_size));
+        bench.relative(true);
+        bench.context("length", fmt::format("{}", fragment_size));
+        bench.batch(fragment_count * fragment_size).unit("byte");
+
+        bench.run("concat + pwrite", [&] {
+            bs::string out;
+            for (const bs::string& fragment : fragments) {
+                out.append(fragment);
+            }
+            bench.doNotOptimizeAway(::pwrite(fd, out.data(), out.size(), 0));
+        });
+        bs::io_slices slices(fragment_count);
+        bench.run("io_slices + pwritev", [&] {
+            for (const bs::string& fragment : fragments) {
+                slices.push_back(fragment);
+            }
+            bench.doNotOptimizeAway(slices.pwritev(fd, 0));
+        });
+        bench.batch(1);
+    }
+
+    ::close(fd);
+    std::remove(path.c_str());
+}
+
+#endif
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "../add_benchmark_macro.hpp"
+#include <betterstring/line_reader.hpp>
+#include <fmt/format.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fcntl.h>
+#ifdef _WIN32
+    #include <io.h>
+#else
+    #include <unistd.h>
+#endif
+
+static int benchmark_open_file(const std::string& path) {
+#ifdef _WIN32
+    return ::_open(path.c_str(), _O_RDONLY | _O_BINARY);
+#else
+    return ::open(path.c_str(), O_RDONLY);
+#endif
+}
+
+static void benchmark_close_file(const int fd) {
+#ifdef _WIN32
+    ::_close(fd);
+#else
+    ::close(fd);
+#endif
+}
+
+ADD_BENCHMARK("line_reader") {
+    using ankerl::nanobench::Rng;
+
+    const std::size_t length = std::size_t(256) << 20;
+    bench.title(fmt::format("reading lines of a {} MiB file", length >> 20));
+    bench.relative(true);
+    bench.context("length", fmt::format("{} MiB", length >> 20));
+    bench.minEpochIterations(1);
+    bench.batch(length).unit("byte");
+
+    const std::string path = (std::filesystem::temp_directory_path() / "betterstring_line_reader_benchmark.txt").string();
+    {
+        Rng rng;
+        std::vector<char> text(std::size_t(1) << 20);
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        for (std::size_t written = 0; written < length; written += text.size()) {
+            for (char& ch : text) {
+                ch = rng.bounded(100) == 0 ? '\n' : static_cast<char>('a' + rng.bounded(26));
+            }
+            file.write(text.data(), static_cast<std::streamsize>(text.size()));
+        }
+    }
+
+    bench.run("std::getline", [&]() {
+        std::ifstream file(path, std::ios::binary);
+        std::string line;
+        std::size_t total = 0;
+        while (std::getline(file, line)) {
+            total += line.size();
+        }
+        bench.doNotOptimizeAway(total);
+    });
+    bench.run("read + std::string_view::find", [&]() {
+        const int fd = benchmark_open_file(path);
+        std::vector<char> buffer(std::size_t(1) << 20);
+        std::string partial;
+        std::size_t total = 0;
+        while (true) {
+#ifdef _WIN32
+            const int count = ::_read(fd, buffer.data(), static_cast<unsigned int>(buffer.size()));
+#else
+            const auto count = ::read(fd, buffer.data(), buffer.size());
+#endif
+            if (count <= 0) { break; }
+            std::string_view rest(buffer.data(), static_cast<std::size_t>(count));
+            while (true) {
+                const std::size_t newline = rest.find('\n');
+                if (newline == std::string_view::npos) { break; }
+                partial.append(rest.data(), newline);
+                total += partial.size();
+                partial.clear();
+                rest.remove_prefix(newline + 1);
+            }
+            partial.append(rest.data(), rest.size());
+        }
+        total += partial.size();
+        benchmark_close_file(fd);
+        bench.doNotOptimizeAway(total);
+    });
+    bench.run("bs::line_reader", [&]() {
+        const int fd = benchmark_open_file(path);
+        bs::line_reader reader(fd);
+        std::size_t total = 0;
+        for (const bs::string_view line : reader) {
+            total += line.size();
+        }
+        benchmark_close_file(fd);
+        bench.doNotOptimizeAway(total);
+    });
+
+    std::remove(path.c_str());
+}
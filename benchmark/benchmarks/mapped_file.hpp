@@ -0,0 +1,76 @@
+#pragma once
+
+#include "../add_benchmark_macro.hpp"
+#include <betterstring/mapped_file.hpp>
+#include <betterstring/string.hpp>
+#include <betterstring/functions.hpp>
+#include <fmt/format.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+ADD_BENCHMARK("mapped_file_count") {
+    using ankerl::nanobench::Rng;
+
+    // larger than the last level cache
+    const std::size_t length = std::size_t(512) << 20;
+    bench.title(fmt::format("count('\\n') over a {} MiB file", length >> 20));
+    bench.relative(true);
+    bench.minEpochIterations(1);
+    bench.context("length", fmt::format("{} MiB", length >> 20));
+
+    const std::string path = (std::filesystem::temp_directory_path() / "betterstring_mapped_file_benchmark.txt").string();
+    {
+        Rng rng;
+        std::vector<char> text(std::size_t(1) << 20);
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        for (std::size_t written = 0; written < length; written += text.size()) {
+            for (char& ch : text) {
+                ch = rng.bounded(80) == 0 ? '\n' : static_cast<char>('a' + rng.bounded(26));
+            }
+            file.write(text.data(), static_cast<std::streamsize>(text.size()));
+        }
+    }
+
+    bench.run("read into bs::string + strcount", [&]() {
+        std::ifstream file(path, std::ios::binary);
+        bs::string content;
+        content.resize_and_overwrite(length, [&](char* const dest, const std::size_t count) {
+            file.read(dest, static_cast<std::streamsize>(count));
+            return static_cast<std::size_t>(file.gcount());
+        });
+        bench.doNotOptimizeAway(bs::strcount(content.data(), content.size(), '\n'));
+    });
+    bench.run("mapped_file + strcount", [&]() {
+        const bs::mapped_file file(path.c_str());
+        bench.doNotOptimizeAway(bs::strcount(file.data(), file.size(), '\n'));
+    });
+    bench.run("mapped_file (sequential) + strcount", [&]() {
+        const bs::mapped_file file(path.c_str());
+        file.advise(bs::mapped_file::access_hint::sequential);
+        bench.doNotOptimizeAway(bs::strcount(file.data(), file.size(), '\n'));
+    });
+    bench.run("mapped_file (huge pages) + for_each_page", [&]() {
+        const bs::mapped_file file(path.c_str());
+        file.advise(bs::mapped_file::access_hint::huge_pages);
+        std::size_t count = 0;
+        bs::for_each_page(file.view(), [&](const bs::string_view page) {
+            count += bs::strcount(page.data(), page.size(), '\n');
+        });
+        bench.doNotOptimizeAway(count);
+    });
+    bench.run("mapped_file (sequential) + for_each_page", [&]() {
+        const bs::mapped_file file(path.c_str());
+        file.advise(bs::mapped_file::access_hint::sequential);
+        std::size_t count = 0;
+        bs::for_each_page(file.view(), [&](const bs::string_view page) {
+            count += bs::strcount(page.data(), page.size(), '\n');
+        });
+        bench.doNotOptimizeAway(count);
+    });
+
+    std::remove(path.c_str());
+}
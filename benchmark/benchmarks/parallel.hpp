@@ -0,0 +1,51 @@
+#pragma once
+
+#include "../add_benchmark_macro.hpp"
+#include <betterstring/parallel.hpp>
+#include <betterstring/split_index.hpp>
+#include <fmt/format.h>
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+ADD_BENCHMARK("parallel_scaling") {
+    using ankerl::nanobench::Rng;
+
+    Rng rng;
+    const std::size_t length = std::size_t(256) << 20;
+    bench.title(fmt::format("scaling with the number of threads (length {} MiB)", length >> 20));
+    bench.relative(true);
+    bench.minEpochIterations(1);
+
+    std::vector<char> text(length);
+    for (char& ch : text) {
+        ch = rng.bounded(64) == 0 ? '\n' : static_cast<char>('a' + rng.bounded(26));
+    }
+    const bs::string_view str(text.data(), text.size());
+
+    std::vector<std::size_t> thread_counts;
+    const std::size_t max_threads = bs::par::thread_pool::default_concurrency();
+    for (std::size_t threads = 1; threads < max_threads; threads *= 2) {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    for (const std::size_t threads : thread_counts) {
+        bs::par::thread_pool pool(threads);
+        bench.context("length", fmt::format("{} threads", threads));
+
+        bench.run(fmt::format("par::count ({} threads)", threads), [&]() {
+            bench.doNotOptimizeAway(bs::par::count(pool, str, '\n'));
+        });
+        bench.run(fmt::format("par::find_first ({} threads)", threads), [&]() {
+            bench.doNotOptimizeAway(bs::par::find_first(pool, str, bs::string_view("\n\n\n\n")).index_or_npos());
+        });
+        bench.run(fmt::format("par::find_all ({} threads)", threads), [&]() {
+            bench.doNotOptimizeAway(bs::par::find_all(pool, str, '\n').size());
+        });
+        bench.run(fmt::format("par::split_index ({} threads)", threads), [&]() {
+            bench.doNotOptimizeAway(bs::par::split_index(pool, str, '\n').size());
+        });
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "../add_benchmark_macro.hpp"
+#include <betterstring/rope.hpp>
+#include <betterstring/string.hpp>
+#include <fmt/format.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+ADD_BENCHMARK("rope") {
+    const std::array<std::size_t, 3> lengths{std::size_t(1) << 16, std::size_t(1) << 20, std::size_t(1) << 24};
+    const bs::string_view edit("inserted text");
+    const bs::string_view needle("\naaa");
+
+    for (const std::size_t length : lengths) {
+        std::string text(length, 'a');
+        for (std::size_t i = 0; i < length; i += 61) {
+            text[i] = '\n';
+        }
+        const bs::string_view document(text.data(), text.size());
+
+        bs::string str(document);
+        bs::rope rope(document);
+        ankerl::nanobench::Rng rng;
+        const auto next_position = [&](const std::size_t size) {
+            return static_cast<std::size_t>(rng.bounded(static_cast<std::uint32_t>(size + 1)));
+        };
+
+        bench.title(fmt::format("insert and erase at random positions of a document of length {}", length));
+        bench.relative(true);
+        bench.context("length", fmt::format("{}", length));
+        bench.unit("edit");
+
+        bench.run("bs::string", [&] {
+            const std::size_t position = next_position(str.size());
+            str.insert(position, edit);
+            str.erase(next_position(str.size() - edit.size()), edit.size());
+            bench.doNotOptimizeAway(str.data());
+        });
+        bench.run("bs::rope", [&] {
+            const std::size_t position = next_position(rope.size());
+            rope.insert(position, edit);
+            rope.erase(next_position(rope.size() - edit.size()), edit.size());
+            bench.doNotOptimizeAway(rope.size());
+        });
+
+        bench.title(fmt::format("count substrings in a document of length {}", length));
+        bench.relative(true);
+        bench.batch(length).unit("byte");
+
+        bench.run("bs::string", [&] {
+            bench.doNotOptimizeAway(bs::string_view(str).count(needle));
+        });
+        bench.run("bs::rope", [&] {
+            bench.doNotOptimizeAway(rope.count(needle));
+        });
+        bench.batch(1);
+    }
+}
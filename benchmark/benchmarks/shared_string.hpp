@@ -0,0 +1,52 @@
+#pragma once
+
+#include "../add_benchmark_macro.hpp"
+#include <betterstring/shared_string.hpp>
+#include <betterstring/string.hpp>
+#include <fmt/format.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+ADD_BENCHMARK("shared_string") {
+    constexpr std::size_t consumer_count = 16;
+    const std::array<std::size_t, 4> lengths{16, 256, 4096, 65536};
+
+    for (const std::size_t length : lengths) {
+        const std::string text(length, 'p');
+        const bs::string payload(bs::string_view(text.data(), text.size()));
+        const bs::shared_string shared_payload(payload);
+        const bs::local_shared_string local_payload(payload);
+
+        bench.title(fmt::format("fan-out of a payload of length {} to {} consumers", length, consumer_count));
+        bench.relative(true);
+        bench.context("length", fmt::format("{}", length));
+        bench.batch(consumer_count).unit("consumer");
+
+        bench.run("bs::string", [&] {
+            std::vector<bs::string> consumers;
+            consumers.reserve(consumer_count);
+            for (std::size_t i = 0; i < consumer_count; ++i) {
+                consumers.push_back(payload);
+            }
+            bench.doNotOptimizeAway(consumers.data());
+        });
+        bench.run("bs::shared_string", [&] {
+            std::vector<bs::shared_string> consumers;
+            consumers.reserve(consumer_count);
+            for (std::size_t i = 0; i < consumer_count; ++i) {
+                consumers.push_back(shared_payload);
+            }
+            bench.doNotOptimizeAway(consumers.data());
+        });
+        bench.run("bs::local_shared_string", [&] {
+            std::vector<bs::local_shared_string> consumers;
+            consumers.reserve(consumer_count);
+            for (std::size_t i = 0; i < consumer_count; ++i) {
+                consumers.push_back(local_payload);
+            }
+            bench.doNotOptimizeAway(consumers.data());
+        });
+    }
+}
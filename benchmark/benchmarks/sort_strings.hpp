@@ -0,0 +1,79 @@
+#pragma once
+
+#include "../add_benchmark_macro.hpp"
+#include <betterstring/sort_strings.hpp>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+ADD_BENCHMARK("sort_strings") {
+    using ankerl::nanobench::Rng;
+
+    constexpr std::size_t count = 1000000;
+    const std::array<const char*, 4> hosts{"https://www.example.com/", "https://api.example.org/v1/",
+        "http://cdn.example.net/static/", "https://shop.example.com/products/"};
+
+    Rng rng;
+    // URLs share long prefixes, words are short and differ early
+    std::vector<std::string> urls;
+    std::vector<std::string> words;
+    for (std::size_t i = 0; i < count; ++i) {
+        std::string url = hosts[rng.bounded(static_cast<std::uint32_t>(hosts.size()))];
+        const std::uint32_t segments = 1 + rng.bounded(3);
+        for (std::uint32_t segment = 0; segment < segments; ++segment) {
+            const std::uint32_t length = 3 + rng.bounded(8);
+            for (std::uint32_t j = 0; j < length; ++j) {
+                url += static_cast<char>('a' + rng.bounded(26));
+            }
+            url += '/';
+        }
+        url += std::to_string(rng.bounded(100000));
+        urls.push_back(std::move(url));
+
+        std::string word;
+        const std::uint32_t length = 2 + rng.bounded(10);
+        for (std::uint32_t j = 0; j < length; ++j) {
+            word += static_cast<char>('a' + rng.bounded(26));
+        }
+        words.push_back(std::move(word));
+    }
+
+    for (const auto& [name, dataset] : {std::pair{"URLs", &urls}, std::pair{"words", &words}}) {
+        std::vector<bs::string_view> original;
+        for (const std::string& str : *dataset) {
+            original.emplace_back(str.data(), str.size());
+        }
+        std::vector<bs::string_view> strs;
+
+        bench.title(fmt::format("sort {} {}", count, name));
+        bench.relative(true);
+        bench.context("length", name);
+        bench.minEpochIterations(1);
+        bench.batch(count).unit("string");
+
+        bench.run("std::sort + lexicographic_less", [&] {
+            strs = original;
+            std::sort(strs.begin(), strs.end(), bs::lexicographic_less{});
+            bench.doNotOptimizeAway(strs.data());
+        });
+        bench.run("std::sort + operator<", [&] {
+            strs = original;
+            std::sort(strs.begin(), strs.end());
+            bench.doNotOptimizeAway(strs.data());
+        });
+        bench.run("bs::sort_strings", [&] {
+            strs = original;
+            bs::sort_strings(strs);
+            bench.doNotOptimizeAway(strs.data());
+        });
+        bench.run("bs::par::sort_strings", [&] {
+            strs = original;
+            bs::par::sort_strings(strs);
+            bench.doNotOptimizeAway(strs.data());
+        });
+        bench.batch(1);
+    }
+}
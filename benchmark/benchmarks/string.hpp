@@ -0,0 +1,163 @@
+#pragma once
+
+#include "../add_benchmark_macro.hpp"
+#include <betterstring/string.hpp>
+#include <betterstring/growth_policy.hpp>
+#include <fmt/format.h>
+
+#include <vector>
+#include <array>
+#include <string>
+#include <utility>
+
+template<class Policy>
+struct benchmark_growth_traits : bs::char_traits<char> {
+    using growth_policy = Policy;
+};
+
+template<class String>
+static void run_string_footprint_benchmark(ankerl::nanobench::Bench& bench, const char* const policy_name, const std::vector<std::size_t>& lengths) {
+    const std::vector<char> source(lengths.back(), 'x');
+
+    // cached payloads: copies of known-size buffers with a few appended bytes
+    const auto build = [&]() {
+        std::vector<String> strings;
+        strings.reserve(lengths.size());
+        for (const std::size_t length : lengths) {
+            String& str = strings.emplace_back(source.data(), length);
+            str.append("\r\n", 2);
+        }
+        return strings;
+    };
+
+    std::size_t payload_bytes = 0;
+    std::size_t allocated_bytes = 0;
+    for (const String& str : build()) {
+        payload_bytes += str.size();
+        allocated_bytes += str.capacity();
+    }
+    fmt::println(stderr, "{}: payload {} bytes, allocated {} bytes ({:.2f}x)\n",
+        policy_name, payload_bytes, allocated_bytes, double(allocated_bytes) / double(payload_bytes));
+
+    bench.context("length", policy_name);
+    bench.run(policy_name, [&]() {
+        auto strings = build();
+        bench.doNotOptimizeAway(strings.data());
+    });
+}
+
+ADD_BENCHMARK("string_growth_footprint") {
+    using ankerl::nanobench::Rng;
+
+    Rng rng;
+    std::vector<std::size_t> lengths(256);
+    for (std::size_t& length : lengths) {
+        length = 64 + rng.bounded(1 << 16);
+    }
+    lengths.push_back(1 << 20);
+
+    bench.title("bs::stringt memory footprint (copy + append)");
+    bench.relative(true);
+
+    run_string_footprint_benchmark<bs::stringt<benchmark_growth_traits<bs::growth::doubling>>>(bench, "doubling", lengths);
+    run_string_footprint_benchmark<bs::stringt<benchmark_growth_traits<bs::growth::one_and_half>>>(bench, "one_and_half", lengths);
+    run_string_footprint_benchmark<bs::stringt<benchmark_growth_traits<bs::growth::power_of_two>>>(bench, "power_of_two", lengths);
+    run_string_footprint_benchmark<bs::stringt<benchmark_growth_traits<bs::growth::exact>>>(bench, "exact", lengths);
+}
+
+template<std::size_t... I>
+static void run_concat_benchmark(ankerl::nanobench::Bench& bench, const std::array<bs::string_view, 16>& parts, const std::array<std::string, 16>& std_parts, std::index_sequence<I...>) {
+    constexpr std::size_t pieces_count = sizeof...(I);
+    bench.context("length", fmt::format("{}", pieces_count));
+
+    bench.run(fmt::format("bs::concat ({} pieces)", pieces_count), [&]() {
+        bs::string result = bs::concat(parts[I]...);
+        bench.doNotOptimizeAway(result);
+    });
+    bench.run(fmt::format("bs::string::append chain ({} pieces)", pieces_count), [&]() {
+        bs::string result;
+        (result.append(parts[I]), ...);
+        bench.doNotOptimizeAway(result);
+    });
+    bench.run(fmt::format("std::string operator+ ({} pieces)", pieces_count), [&]() {
+        std::string result = (std::string{} + ... + std_parts[I]);
+        bench.doNotOptimizeAway(result);
+    });
+}
+
+ADD_BENCHMARK("concat") {
+    bench.title("concatenation of string pieces");
+
+    const std::array<bs::string_view, 16> parts{
+        "tenant", ":", "4242424242", ":", "session-identifier", ":", "suffix", "/",
+        "some/longer/path/component", "?", "key=value", "&", "another_key=another_value", "#", "fragment", "!"
+    };
+    std::array<std::string, 16> std_parts;
+    for (std::size_t i = 0; i < parts.size(); ++i) {
+        std_parts[i].assign(parts[i].data(), parts[i].size());
+    }
+
+    run_concat_benchmark(bench, parts, std_parts, std::make_index_sequence<2>{});
+    run_concat_benchmark(bench, parts, std_parts, std::make_index_sequence<4>{});
+    run_concat_benchmark(bench, parts, std_parts, std::make_index_sequence<8>{});
+    run_concat_benchmark(bench, parts, std_parts, std::make_index_sequence<16>{});
+}
+
+template<class String, class Make>
+static void run_string_editing_benchmark(ankerl::nanobench::Bench& bench, const char* const name, Make make) {
+    const char patch[] = "0123456789abcdef";
+
+    bench.run(fmt::format("{} insert", name), [&]() {
+        String str = make();
+        str.insert(str.size() / 2, patch);
+        bench.doNotOptimizeAway(str);
+    });
+    bench.run(fmt::format("{} erase", name), [&]() {
+        String str = make();
+        str.erase(str.size() / 4, str.size() / 2);
+        bench.doNotOptimizeAway(str);
+    });
+    bench.run(fmt::format("{} replace (grow)", name), [&]() {
+        String str = make();
+        str.replace(str.size() / 2, 4, patch);
+        bench.doNotOptimizeAway(str);
+    });
+    bench.run(fmt::format("{} replace (shrink)", name), [&]() {
+        String str = make();
+        str.replace(str.size() / 2, 16, "xyz");
+        bench.doNotOptimizeAway(str);
+    });
+    bench.run(fmt::format("{} resize", name), [&]() {
+        String str = make();
+        str.resize(str.size() * 2, '.');
+        bench.doNotOptimizeAway(str);
+    });
+}
+
+ADD_BENCHMARK("string_editing") {
+    bench.title("in-place editing (copy + edit)");
+
+    const std::array<std::size_t, 3> lengths{64, 1024, 64 * 1024};
+    for (const std::size_t length : lengths) {
+        const std::vector<char> source(length, 'x');
+        bench.context("length", fmt::format("{}", length));
+
+        run_string_editing_benchmark<bs::string>(bench, "bs::string", [&]() {
+            return bs::string(source.data(), source.size());
+        });
+        bench.run("bs::string remove_prefix_inplace", [&]() {
+            bs::string str(source.data(), source.size());
+            str.remove_prefix_inplace(16);
+            bench.doNotOptimizeAway(str);
+        });
+
+        run_string_editing_benchmark<std::string>(bench, "std::string", [&]() {
+            return std::string(source.data(), source.size());
+        });
+        bench.run("std::string erase(0, n)", [&]() {
+            std::string str(source.data(), source.size());
+            str.erase(0, 16);
+            bench.doNotOptimizeAway(str);
+        });
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "../add_benchmark_macro.hpp"
+#include <betterstring/string_builder.hpp>
+#include <betterstring/string.hpp>
+#include <fmt/format.h>
+
+#include <array>
+
+ADD_BENCHMARK("string_builder") {
+    const std::array<std::size_t, 3> record_counts{1000, 20000, 400000};
+    const bs::string_view key("\"value\":");
+
+    for (const std::size_t record_count : record_counts) {
+        bench.title(fmt::format("build a response of {} records", record_count));
+        bench.relative(true);
+        bench.context("length", fmt::format("{}", record_count));
+        bench.batch(record_count).unit("record");
+
+        bench.run("bs::string append", [&] {
+            bs::string out;
+            for (std::size_t i = 0; i < record_count; ++i) {
+                out.append_all('{', key, i, ",\"name\":\"record\"},\n");
+            }
+            bench.doNotOptimizeAway(out.data());
+        });
+        // the builder is cleared and reused, as for the responses of a server
+        bs::string_builder builder;
+        bench.run("bs::string_builder build", [&] {
+            builder.clear();
+            for (std::size_t i = 0; i < record_count; ++i) {
+                builder.append_all('{', key, i, ",\"name\":\"record\"},\n");
+            }
+            const bs::string out = builder.build();
+            bench.doNotOptimizeAway(out.data());
+        });
+        bench.run("bs::string_builder segments", [&] {
+            builder.clear();
+            for (std::size_t i = 0; i < record_count; ++i) {
+                builder.append_all('{', key, i, ",\"name\":\"record\"},\n");
+            }
+            std::size_t total = 0;
+            for (const bs::string_view part : builder.segments()) {
+                total += part.size();
+            }
+            bench.doNotOptimizeAway(total);
+        });
+        bench.batch(1);
+    }
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "../add_benchmark_macro.hpp"
+#include <betterstring/string.hpp>
+#include <fmt/format.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+template<class Layout>
+struct benchmark_layout_traits : bs::char_traits<char> {
+    using string_layout = Layout;
+};
+template<class Layout>
+using benchmark_layout_string = bs::stringt<benchmark_layout_traits<Layout>>;
+
+// the bytes of the vector of the strings and of their heap buffers
+template<class Layout>
+static std::size_t layout_footprint(const std::vector<std::string>& texts) {
+    std::vector<benchmark_layout_string<Layout>> strings;
+    strings.reserve(texts.size());
+    std::size_t bytes = texts.size() * sizeof(benchmark_layout_string<Layout>);
+    for (const std::string& text : texts) {
+        const auto& str = strings.emplace_back(text.data(), text.size());
+        if (reinterpret_cast<const void*>(str.data()) != reinterpret_cast<const void*>(&str)) {
+            bytes += str.capacity();
+        }
+    }
+    return bytes;
+}
+
+template<class Layout>
+static void layout_run(ankerl::nanobench::Bench& bench, const char* const name, const std::vector<std::string>& texts) {
+    fmt::println(stderr, "{:<40} {:>3} bytes per string, {:>10} bytes in total", name,
+        sizeof(benchmark_layout_string<Layout>), layout_footprint<Layout>(texts));
+    bench.run(name, [&] {
+        std::vector<benchmark_layout_string<Layout>> strings;
+        strings.reserve(texts.size());
+        for (const std::string& text : texts) {
+            strings.emplace_back(text.data(), text.size());
+        }
+        std::size_t total = 0;
+        for (const auto& str : strings) {
+            total += str.size() + std::size_t(str.front());
+        }
+        bench.doNotOptimizeAway(total);
+    });
+}
+
+ADD_BENCHMARK("string_layout") {
+    using ankerl::nanobench::Rng;
+
+    constexpr std::size_t count = 100000;
+    struct length_range {
+        const char* name;
+        std::uint32_t min;
+        std::uint32_t max;
+    };
+    const std::array<length_range, 3> ranges{{{"short", 1, 15}, {"medium", 16, 55}, {"long", 64, 256}}};
+
+    for (const length_range& range : ranges) {
+        Rng rng;
+        std::vector<std::string> texts;
+        texts.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            texts.emplace_back(range.min + rng.bounded(range.max - range.min + 1), char('a' + rng.bounded(26)));
+        }
+
+        fmt::println(stderr, "{} strings of length {}..{}:", count, range.min, range.max);
+        bench.title(fmt::format("construct and scan {} {} strings", count, range.name));
+        bench.relative(true);
+        bench.minEpochIterations(4);
+        bench.context("length", fmt::format("{}..{}", range.min, range.max));
+        bench.batch(count).unit("string");
+
+        layout_run<bs::layout::standard>(bench, "bs::layout::standard", texts);
+        layout_run<bs::layout::compact>(bench, "bs::layout::compact", texts);
+        layout_run<bs::layout::cache_line>(bench, "bs::layout::cache_line", texts);
+        layout_run<bs::layout::extended<40>>(bench, "bs::layout::extended<40>", texts);
+        layout_run<bs::layout::extended<56>>(bench, "bs::layout::extended<56>", texts);
+        fmt::println(stderr, "");
+    }
+}
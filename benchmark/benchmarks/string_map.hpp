@@ -0,0 +1,99 @@
+#pragma once
+
+#include "../add_benchmark_macro.hpp"
+#include <betterstring/string_map.hpp>
+#include <fmt/format.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+ADD_BENCHMARK("string_map_lookup") {
+    using ankerl::nanobench::Rng;
+
+    const std::array<std::size_t, 3> key_lengths{8, 20, 40};
+    const std::size_t key_count = 100000;
+    for (const std::size_t key_length : key_lengths) {
+        Rng rng;
+        std::vector<std::string> keys;
+        keys.reserve(key_count);
+        for (std::size_t i = 0; i < key_count; ++i) {
+            std::string key = fmt::format("{}", i);
+            while (key.size() < key_length) {
+                key += static_cast<char>('a' + rng.bounded(26));
+            }
+            keys.push_back(std::move(key));
+        }
+        // lookups in random order, every second key is missing
+        std::vector<std::string> queries;
+        queries.reserve(key_count);
+        for (std::size_t i = 0; i < key_count; ++i) {
+            std::string query = keys[rng.bounded(static_cast<std::uint32_t>(key_count))];
+            if (i % 2 == 0) {
+                query.back() = '#';
+            }
+            queries.push_back(std::move(query));
+        }
+
+        std::unordered_map<std::string, std::uint32_t> std_map;
+        bs::string_map<std::uint32_t> bs_map;
+        for (std::size_t i = 0; i < key_count; ++i) {
+            std_map.emplace(keys[i], static_cast<std::uint32_t>(i));
+            bs_map.try_emplace(bs::string_view(keys[i].data(), keys[i].size()), static_cast<std::uint32_t>(i));
+        }
+
+        bench.title(fmt::format("lookup of {} keys of length {}", key_count, key_length));
+        bench.relative(true);
+        bench.context("length", fmt::format("{}", key_length));
+        bench.batch(key_count).unit("lookup");
+
+        bench.run("std::unordered_map<std::string, ...>", [&] {
+            std::uint32_t sum = 0;
+            for (const std::string& query : queries) {
+                const auto it = std_map.find(query);
+                sum += it == std_map.end() ? 0 : it->second;
+            }
+            bench.doNotOptimizeAway(sum);
+        });
+        bench.run("bs::string_map", [&] {
+            std::uint32_t sum = 0;
+            for (const std::string& query : queries) {
+                const auto it = bs_map.find(bs::string_view(query.data(), query.size()));
+                sum += it == bs_map.end() ? 0 : it.value();
+            }
+            bench.doNotOptimizeAway(sum);
+        });
+    }
+}
+
+ADD_BENCHMARK("string_map_insert") {
+    const std::size_t key_count = 100000;
+    std::vector<std::string> keys;
+    keys.reserve(key_count);
+    for (std::size_t i = 0; i < key_count; ++i) {
+        keys.push_back(fmt::format("field_{}", i));
+    }
+
+    bench.title(fmt::format("insertion of {} keys", key_count));
+    bench.relative(true);
+    bench.context("length", fmt::format("{} keys", key_count));
+    bench.batch(key_count).unit("insert");
+
+    bench.run("std::unordered_map<std::string, ...>", [&] {
+        std::unordered_map<std::string, std::uint32_t> map;
+        for (std::size_t i = 0; i < key_count; ++i) {
+            map.emplace(keys[i], static_cast<std::uint32_t>(i));
+        }
+        bench.doNotOptimizeAway(map.size());
+    });
+    bench.run("bs::string_map", [&] {
+        bs::string_map<std::uint32_t> map;
+        for (std::size_t i = 0; i < key_count; ++i) {
+            map.try_emplace(bs::string_view(keys[i].data(), keys[i].size()), static_cast<std::uint32_t>(i));
+        }
+        bench.doNotOptimizeAway(map.size());
+    });
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "../add_benchmark_macro.hpp"
+#include <betterstring/string_switch.hpp>
+#include <fmt/format.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+template<std::size_t N>
+static void run_string_switch_benchmark(ankerl::nanobench::Bench& bench) {
+    ankerl::nanobench::Rng rng;
+    // command names of different lengths with common prefixes
+    std::vector<std::string> storage;
+    for (std::size_t i = 0; i < N; ++i) {
+        storage.push_back(fmt::format("{}_{}", i % 3 == 0 ? "get" : i % 3 == 1 ? "set_option" : "subscribe", i));
+    }
+    std::array<bs::string_view, N> keys;
+    for (std::size_t i = 0; i < N; ++i) {
+        keys[i] = bs::string_view(storage[i].data(), storage[i].size());
+    }
+    const bs::string_switch<N> commands(keys);
+    std::unordered_map<std::string_view, std::size_t> map;
+    for (std::size_t i = 0; i < N; ++i) {
+        map.emplace(std::string_view(storage[i].data(), storage[i].size()), i);
+    }
+
+    // every fourth query is not a key
+    const std::size_t query_count = 4096;
+    std::vector<std::string> queries;
+    for (std::size_t i = 0; i < query_count; ++i) {
+        queries.push_back(storage[rng.bounded(static_cast<std::uint32_t>(N))] + (i % 4 == 0 ? "x" : ""));
+    }
+
+    bench.context("length", fmt::format("{} keys", N));
+    bench.batch(query_count).unit("lookup");
+    bench.run(fmt::format("if-chain of operator== ({} keys)", N), [&] {
+        std::size_t sum = 0;
+        for (const std::string& query : queries) {
+            const bs::string_view str(query.data(), query.size());
+            for (std::size_t i = 0; i < N; ++i) {
+                if (keys[i] == str) {
+                    sum += i;
+                    break;
+                }
+            }
+        }
+        bench.doNotOptimizeAway(sum);
+    });
+    bench.run(fmt::format("std::unordered_map<std::string_view, ...> ({} keys)", N), [&] {
+        std::size_t sum = 0;
+        for (const std::string& query : queries) {
+            const auto it = map.find(std::string_view(query.data(), query.size()));
+            sum += it == map.end() ? 0 : it->second;
+        }
+        bench.doNotOptimizeAway(sum);
+    });
+    bench.run(fmt::format("bs::string_switch ({} keys)", N), [&] {
+        std::size_t sum = 0;
+        for (const std::string& query : queries) {
+            const std::size_t index = commands.find(bs::string_view(query.data(), query.size()));
+            sum += index == commands.npos ? 0 : index;
+        }
+        bench.doNotOptimizeAway(sum);
+    });
+}
+
+ADD_BENCHMARK("string_switch") {
+    bench.title("dispatch on a fixed set of strings");
+    bench.relative(true);
+    run_string_switch_benchmark<4>(bench);
+    run_string_switch_benchmark<16>(bench);
+    run_string_switch_benchmark<64>(bench);
+    run_string_switch_benchmark<256>(bench);
+}
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "../add_benchmark_macro.hpp"
+#include <betterstring/string_view.hpp>
+#include <betterstring/split_index.hpp>
+#include <fmt/format.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+ADD_BENCHMARK("find_all") {
+    using ankerl::nanobench::Rng;
+
+    Rng rng;
+    const std::size_t length = 1 << 20;
+    bench.title(fmt::format("positions of every '\\n' (length {})", length));
+    bench.relative(true);
+
+    const std::array<std::uint32_t, 3> line_lengths{16, 80, 1024};
+    for (const std::uint32_t line_length : line_lengths) {
+        std::vector<char> text(length);
+        for (char& ch : text) {
+            ch = rng.bounded(line_length) == 0 ? '\n' : static_cast<char>('a' + rng.bounded(26));
+        }
+        const bs::string_view str(text.data(), text.size());
+        std::vector<std::uint32_t> positions(text.size());
+
+        bench.context("length", fmt::format("average line {}", line_length));
+        bench.run("repeated find(ch, start)", [&]() {
+            std::size_t count = 0;
+            std::size_t start = 0;
+            while (true) {
+                const auto found = str.find('\n', start);
+                if (!found.index_opt()) { break; }
+                positions[count++] = static_cast<std::uint32_t>(found.index());
+                start = found.index() + 1;
+            }
+            bench.doNotOptimizeAway(count);
+        });
+        bench.run("find_all iterator", [&]() {
+            std::size_t count = 0;
+            for (const std::size_t position : str.find_all('\n')) {
+                positions[count++] = static_cast<std::uint32_t>(position);
+            }
+            bench.doNotOptimizeAway(count);
+        });
+        bench.run("find_all positions_into", [&]() {
+            const std::size_t count = str.find_all('\n').positions_into(positions.data(), positions.size());
+            bench.doNotOptimizeAway(count);
+        });
+        bench.run("find_all(\"\\n\"_sv) iterator", [&]() {
+            std::size_t count = 0;
+            for (const std::size_t position : str.find_all(bs::string_view("\n"))) {
+                positions[count++] = static_cast<std::uint32_t>(position);
+            }
+            bench.doNotOptimizeAway(count);
+        });
+    }
+}
+
+ADD_BENCHMARK("split_index") {
+    using ankerl::nanobench::Rng;
+
+    Rng rng;
+    const std::size_t length = 1 << 20;
+    bench.title(fmt::format("splitting into fields (length {})", length));
+    bench.relative(true);
+
+    const std::array<std::uint32_t, 3> field_lengths{4, 16, 128};
+    for (const std::uint32_t field_length : field_lengths) {
+        std::vector<char> text(length);
+        for (char& ch : text) {
+            ch = rng.bounded(field_length) == 0 ? ',' : static_cast<char>('a' + rng.bounded(26));
+        }
+        const bs::string_view str(text.data(), text.size());
+
+        bench.context("length", fmt::format("average field {}", field_length));
+        bench.run("split() iteration", [&]() {
+            std::size_t total = 0;
+            for (const bs::string_view field : str.split(',')) {
+                total += field.size();
+            }
+            bench.doNotOptimizeAway(total);
+        });
+        bench.run("split_index() iteration", [&]() {
+            std::size_t total = 0;
+            for (const bs::string_view field : bs::split_index(str, ',')) {
+                total += field.size();
+            }
+            bench.doNotOptimizeAway(total);
+        });
+
+        std::vector<std::uint32_t> buffer;
+        bench.run("split_index() with reused buffer", [&]() {
+            auto fields = bs::split_index(str, ',', std::move(buffer));
+            bench.doNotOptimizeAway(fields.size());
+            buffer = std::move(fields).release_offsets();
+        });
+    }
+}
+
+ADD_BENCHMARK("split_any_of") {
+    using ankerl::nanobench::Rng;
+
+    Rng rng;
+    const std::size_t length = 1 << 20;
+    bench.title(fmt::format("tokenizing (length {})", length));
+    bench.relative(true);
+
+    const bs::string_view delimiters = ",;\t";
+    const bs::string_view whitespace = " \t\n\v\f\r";
+    const std::array<std::uint32_t, 3> field_lengths{4, 16, 128};
+    for (const std::uint32_t field_length : field_lengths) {
+        std::vector<char> text(length);
+        for (char& ch : text) {
+            ch = rng.bounded(field_length) == 0 ? delimiters[rng.bounded(3)] : static_cast<char>('a' + rng.bounded(26));
+        }
+        const bs::string_view str(text.data(), text.size());
+
+        bench.context("length", fmt::format("average field {}", field_length));
+        bench.run("per character delimiter check", [&]() {
+            std::size_t total = 0;
+            std::size_t start = 0;
+            for (std::size_t i = 0; i < str.size(); ++i) {
+                if (delimiters.contains(str[i])) {
+                    total += i - start;
+                    start = i + 1;
+                }
+            }
+            total += str.size() - start;
+            bench.doNotOptimizeAway(total);
+        });
+        bench.run("split_any_of", [&]() {
+            std::size_t total = 0;
+            for (const bs::string_view field : str.split_any_of(delimiters)) {
+                total += field.size();
+            }
+            bench.doNotOptimizeAway(total);
+        });
+
+        std::vector<char> words(text);
+        for (char& ch : words) {
+            if (delimiters.contains(ch)) { ch = ' '; }
+        }
+        const bs::string_view words_str(words.data(), words.size());
+        bench.run("repeated find_not + find (whitespace)", [&]() {
+            std::size_t total = 0;
+            bs::string_view rest = words_str;
+            while (true) {
+                const auto start = rest.find_not(' ');
+                if (!start.index_opt()) { break; }
+                rest.remove_prefix(start.index());
+                const std::size_t end = rest.find_first_of(whitespace).index_or_end();
+                total += end;
+                rest.remove_prefix(end);
+            }
+            bench.doNotOptimizeAway(total);
+        });
+        bench.run("split_whitespace", [&]() {
+            std::size_t total = 0;
+            for (const bs::string_view word : words_str.split_whitespace()) {
+                total += word.size();
+            }
+            bench.doNotOptimizeAway(total);
+        });
+    }
+}
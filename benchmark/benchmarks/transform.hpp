@@ -0,0 +1,68 @@
+#pragma once
+
+#include "../add_benchmark_macro.hpp"
+#include <betterstring/transform.hpp>
+#include <fmt/format.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+// escapes every delimiter by hand: find the next match and append the pieces
+static std::string replace_with_find_append(const std::string& text, const char from, const std::string& to) {
+    std::string out;
+    std::size_t pos = 0;
+    while (true) {
+        const std::size_t match = text.find(from, pos);
+        if (match == std::string::npos) { break; }
+        out.append(text, pos, match - pos);
+        out.append(to);
+        pos = match + 1;
+    }
+    out.append(text, pos, std::string::npos);
+    return out;
+}
+
+ADD_BENCHMARK("replace_all") {
+    using ankerl::nanobench::Rng;
+
+    Rng rng;
+    const std::size_t length = 64 * 1024;
+    bench.title(fmt::format("escaping delimiters (length {})", length));
+    bench.relative(true);
+
+    const std::array<std::uint32_t, 3> frequencies{8, 64, 1024};
+    for (const std::uint32_t every : frequencies) {
+        std::string text(length, 'x');
+        for (char& ch : text) {
+            ch = static_cast<char>('a' + rng.bounded(26));
+            if (rng.bounded(every) == 0) { ch = ','; }
+        }
+        const bs::string_view view(text.data(), text.size());
+        const std::string escape = "\\,";
+
+        bench.context("length", fmt::format("1/{} delimiters", every));
+        bench.run("std::string find + append", [&]() {
+            auto result = replace_with_find_append(text, ',', escape);
+            bench.doNotOptimizeAway(result);
+        });
+        bench.run("bs::replace_all (char -> string)", [&]() {
+            auto result = bs::replace_all(view, ',', "\\,");
+            bench.doNotOptimizeAway(result);
+        });
+        bench.run("bs::replace_all (char -> char)", [&]() {
+            auto result = bs::replace_all(view, ',', ';');
+            bench.doNotOptimizeAway(result);
+        });
+        bench.run("bs::replace_all (string -> string)", [&]() {
+            auto result = bs::replace_all(view, ",", "\\,");
+            bench.doNotOptimizeAway(result);
+        });
+
+        const auto table = bs::make_translation_table(",", ";");
+        bench.run("bs::translate", [&]() {
+            auto result = bs::translate(view, table);
+            bench.doNotOptimizeAway(result);
+        });
+    }
+}
@@ -10,6 +10,24 @@
 
 #include "benchmarks/functions.hpp"
 #include "benchmarks/parsing.hpp"
+#include "benchmarks/allocators.hpp"
+#include "benchmarks/string.hpp"
+#include "benchmarks/transform.hpp"
+#include "benchmarks/string_view.hpp"
+#include "benchmarks/parallel.hpp"
+#include "benchmarks/mapped_file.hpp"
+#include "benchmarks/line_reader.hpp"
+#include "benchmarks/hash.hpp"
+#include "benchmarks/string_map.hpp"
+#include "benchmarks/intern_pool.hpp"
+#include "benchmarks/string_switch.hpp"
+#include "benchmarks/inline_string.hpp"
+#include "benchmarks/string_layout.hpp"
+#include "benchmarks/shared_string.hpp"
+#include "benchmarks/rope.hpp"
+#include "benchmarks/string_builder.hpp"
+#include "benchmarks/io_slices.hpp"
+#include "benchmarks/sort_strings.hpp"
 
 #ifdef _WIN32
     #define WIN32_LEAN_AND_MEAN
@@ -6,8 +6,11 @@
 #pragma once
 
 #include <betterstring/detail/preprocessor.hpp>
+#include <betterstring/detail/bit.hpp>
 #include <cstddef>
+#include <cstdint>
 #include <new>
+#include <mutex>
 #include <type_traits>
 
 namespace bs {
@@ -76,4 +79,355 @@ public:
     }
 };
 
+// Bump-pointer arena. Memory is carved out of chained chunks and is returned
+// only in bulk by release() (or by the destructor).
+class monotonic_arena {
+public:
+    static constexpr std::size_t default_chunk_size = 4096;
+
+    explicit monotonic_arena(const std::size_t initial_chunk_size = default_chunk_size) noexcept
+        : first_chunk_size(initial_chunk_size < sizeof(chunk_header) * 2 ? sizeof(chunk_header) * 2 : initial_chunk_size)
+        , next_chunk_size(first_chunk_size) {}
+
+    monotonic_arena(const monotonic_arena&) = delete;
+    monotonic_arena& operator=(const monotonic_arena&) = delete;
+
+    ~monotonic_arena() noexcept {
+        release();
+    }
+
+    [[nodiscard]] void* allocate(const std::size_t bytes, const std::size_t alignment) {
+        BS_VERIFY(detail::is_power_of_two(alignment), "the alignment must be a power of two");
+        std::uintptr_t aligned = align_up(reinterpret_cast<std::uintptr_t>(cursor), alignment);
+        const std::uintptr_t end = reinterpret_cast<std::uintptr_t>(chunk_end);
+        if (cursor == nullptr || aligned > end || bytes > end - aligned) {
+            // the new chunk holds the header, the bytes and the alignment padding
+            if (bytes > std::size_t(-1) - alignment - sizeof(chunk_header)) { throw std::bad_alloc{}; }
+            new_chunk(bytes + alignment);
+            aligned = align_up(reinterpret_cast<std::uintptr_t>(cursor), alignment);
+        }
+        cursor = reinterpret_cast<char*>(aligned + bytes);
+        return reinterpret_cast<void*>(aligned);
+    }
+    void deallocate(void* const ptr, const std::size_t bytes, [[maybe_unused]] const std::size_t alignment) noexcept {
+        // only the most recent allocation can be given back
+        if (static_cast<char*>(ptr) + bytes == cursor) {
+            cursor = static_cast<char*>(ptr);
+        }
+    }
+
+    // frees every chunk at once, invalidating all memory handed out by the arena
+    void release() noexcept {
+        while (current != nullptr) {
+            chunk_header* const prev = current->prev;
+            ::operator delete(current, current->size, std::align_val_t{chunk_alignment});
+            current = prev;
+        }
+        cursor = nullptr;
+        chunk_end = nullptr;
+        next_chunk_size = first_chunk_size;
+        total_size = 0;
+    }
+
+    std::size_t bytes_reserved() const noexcept { return total_size; }
+
+private:
+    static constexpr std::size_t chunk_alignment = 64;
+
+    struct alignas(chunk_alignment) chunk_header {
+        chunk_header* prev;
+        std::size_t size;
+    };
+
+    static constexpr std::uintptr_t align_up(const std::uintptr_t value, const std::size_t alignment) noexcept {
+        return (value + (alignment - 1)) & ~std::uintptr_t(alignment - 1);
+    }
+
+    BS_NOINLINE void new_chunk(const std::size_t min_bytes) {
+        std::size_t size = next_chunk_size;
+        if (size - sizeof(chunk_header) < min_bytes) {
+            size = min_bytes + sizeof(chunk_header);
+        }
+        void* const memory = ::operator new(size, std::align_val_t{chunk_alignment});
+        chunk_header* const header = ::new(memory) chunk_header{current, size};
+
+        current = header;
+        cursor = reinterpret_cast<char*>(header + 1);
+        chunk_end = reinterpret_cast<char*>(header) + size;
+        total_size += size;
+        // geometric growth of the chunks keeps the number of chained chunks logarithmic
+        next_chunk_size = size * 2;
+    }
+
+    chunk_header* current = nullptr;
+    char* cursor = nullptr;
+    char* chunk_end = nullptr;
+    std::size_t first_chunk_size;
+    std::size_t next_chunk_size;
+    std::size_t total_size = 0;
+};
+
+// Size-class pool that recycles freed buffers. Every block is a separate upstream
+// allocation rounded up to a power of two, so blocks from one pool can be returned
+// into another pool or directly to the global operator delete.
+// The pool is not thread-safe.
+class string_pool {
+public:
+    static constexpr std::size_t min_block_size = 32;
+    static constexpr std::size_t max_block_size = std::size_t(1) << 16;
+    static constexpr std::size_t block_alignment = 64;
+    static constexpr std::size_t size_class_count = 12;
+
+    static_assert((min_block_size << (size_class_count - 1)) == max_block_size);
+
+    explicit string_pool(const std::size_t max_cached_blocks_ = std::size_t(-1)) noexcept
+        : max_cached_blocks(max_cached_blocks_) {}
+
+    string_pool(const string_pool&) = delete;
+    string_pool& operator=(const string_pool&) = delete;
+
+    ~string_pool() noexcept {
+        release();
+    }
+
+    // the size of block actually allocated for a request of `bytes`
+    static constexpr std::size_t block_size(const std::size_t bytes) noexcept {
+        if (bytes > max_block_size) { return bytes; }
+        if (bytes <= min_block_size) { return min_block_size; }
+        return static_cast<std::size_t>(detail::bit_ceil(bytes));
+    }
+
+    [[nodiscard]] void* allocate(const std::size_t bytes, const std::size_t alignment) {
+        if (!is_pooled(bytes, alignment)) {
+            return ::operator new(bytes, std::align_val_t{alignment});
+        }
+        const std::size_t index = size_class(bytes);
+        if (free_block* const block = free_lists[index]) {
+            free_lists[index] = block->next;
+            --cached_blocks[index];
+            return block;
+        }
+        return ::operator new(min_block_size << index, std::align_val_t{block_alignment});
+    }
+    void deallocate(void* const ptr, const std::size_t bytes, const std::size_t alignment) noexcept {
+        if (!is_pooled(bytes, alignment)) {
+            ::operator delete(ptr, bytes, std::align_val_t{alignment});
+            return;
+        }
+        const std::size_t index = size_class(bytes);
+        if (cached_blocks[index] >= max_cached_blocks) {
+            ::operator delete(ptr, min_block_size << index, std::align_val_t{block_alignment});
+            return;
+        }
+        free_lists[index] = ::new(ptr) free_block{free_lists[index]};
+        ++cached_blocks[index];
+    }
+
+    // returns every cached block to the global operator delete
+    void release() noexcept {
+        for (std::size_t index = 0; index < size_class_count; ++index) {
+            free_block* block = free_lists[index];
+            while (block != nullptr) {
+                free_block* const next = block->next;
+                ::operator delete(block, min_block_size << index, std::align_val_t{block_alignment});
+                block = next;
+            }
+            free_lists[index] = nullptr;
+            cached_blocks[index] = 0;
+        }
+    }
+
+    std::size_t cached_count(const std::size_t bytes) const noexcept {
+        if (bytes > max_block_size) { return 0; }
+        return cached_blocks[size_class(bytes)];
+    }
+
+private:
+    friend class thread_cache;
+
+    struct free_block {
+        free_block* next;
+    };
+
+    static constexpr bool is_pooled(const std::size_t bytes, const std::size_t alignment) noexcept {
+        return bytes <= max_block_size && alignment <= block_alignment;
+    }
+    static constexpr std::size_t size_class(const std::size_t bytes) noexcept {
+        BS_VERIFY(bytes <= max_block_size, "the size is not handled by the pool");
+        if (bytes <= min_block_size) { return 0; }
+        return static_cast<std::size_t>(detail::bit_width((bytes - 1) / min_block_size));
+    }
+
+    free_block* free_lists[size_class_count]{};
+    std::size_t cached_blocks[size_class_count]{};
+    std::size_t max_cached_blocks;
+};
+
+// Process-wide string_pool shared between threads, guarded by a mutex.
+template<class Tag = void>
+struct shared_string_pool {
+    static string_pool& resource() noexcept {
+        static string_pool pool;
+        return pool;
+    }
+    static std::mutex& mutex() noexcept {
+        static std::mutex m;
+        return m;
+    }
+
+    [[nodiscard]] static void* allocate(const std::size_t bytes, const std::size_t alignment) {
+        const std::lock_guard lock{mutex()};
+        return resource().allocate(bytes, alignment);
+    }
+    static void deallocate(void* const ptr, const std::size_t bytes, const std::size_t alignment) noexcept {
+        const std::lock_guard lock{mutex()};
+        resource().deallocate(ptr, bytes, alignment);
+    }
+};
+
+// Small bounded per-thread cache of free blocks in front of a shared_string_pool.
+// Hits never take a lock; misses and overflows go to the shared pool.
+class thread_cache {
+public:
+    static constexpr std::size_t max_cached_blocks = 64;
+
+    template<class Shared>
+    [[nodiscard]] void* allocate(const std::size_t bytes, const std::size_t alignment) {
+        if (!string_pool::is_pooled(bytes, alignment)) {
+            return ::operator new(bytes, std::align_val_t{alignment});
+        }
+        const std::size_t index = string_pool::size_class(bytes);
+        if (cache.free_lists[index] == nullptr) {
+            return Shared::allocate(bytes, alignment);
+        }
+        string_pool::free_block* const block = cache.free_lists[index];
+        cache.free_lists[index] = block->next;
+        --cache.cached_blocks[index];
+        return block;
+    }
+    template<class Shared>
+    void deallocate(void* const ptr, const std::size_t bytes, const std::size_t alignment) noexcept {
+        if (!string_pool::is_pooled(bytes, alignment)) {
+            ::operator delete(ptr, bytes, std::align_val_t{alignment});
+            return;
+        }
+        const std::size_t index = string_pool::size_class(bytes);
+        if (cache.cached_blocks[index] >= max_cached_blocks) {
+            Shared::deallocate(ptr, bytes, alignment);
+            return;
+        }
+        cache.free_lists[index] = ::new(ptr) string_pool::free_block{cache.free_lists[index]};
+        ++cache.cached_blocks[index];
+    }
+
+    // moves every cached block to the shared pool
+    template<class Shared>
+    void flush() noexcept {
+        const std::lock_guard lock{Shared::mutex()};
+        for (std::size_t index = 0; index < string_pool::size_class_count; ++index) {
+            while (string_pool::free_block* const block = cache.free_lists[index]) {
+                cache.free_lists[index] = block->next;
+                Shared::resource().deallocate(block, string_pool::min_block_size << index, string_pool::block_alignment);
+            }
+            cache.cached_blocks[index] = 0;
+        }
+    }
+
+private:
+    string_pool cache{max_cached_blocks};
+};
+
+namespace detail {
+    template<class Tag>
+    struct monotonic_arena_handle {
+        static monotonic_arena& resource() noexcept {
+            thread_local monotonic_arena arena;
+            return arena;
+        }
+        [[nodiscard]] static void* allocate(const std::size_t bytes, const std::size_t alignment) {
+            return resource().allocate(bytes, alignment);
+        }
+        static void deallocate(void* const ptr, const std::size_t bytes, const std::size_t alignment) noexcept {
+            resource().deallocate(ptr, bytes, alignment);
+        }
+    };
+
+    template<class Tag>
+    struct thread_cache_handle {
+        struct flushing_cache : thread_cache {
+            flushing_cache() = default;
+            flushing_cache(const flushing_cache&) = delete;
+            flushing_cache& operator=(const flushing_cache&) = delete;
+            ~flushing_cache() noexcept { this->template flush<shared_string_pool<Tag>>(); }
+        };
+
+        static thread_cache& resource() noexcept {
+            thread_local flushing_cache cache;
+            return cache;
+        }
+        [[nodiscard]] static void* allocate(const std::size_t bytes, const std::size_t alignment) {
+            return resource().template allocate<shared_string_pool<Tag>>(bytes, alignment);
+        }
+        static void deallocate(void* const ptr, const std::size_t bytes, const std::size_t alignment) noexcept {
+            resource().template deallocate<shared_string_pool<Tag>>(ptr, bytes, alignment);
+        }
+    };
+}
+
+// Stateless allocator that forwards to a memory resource reachable through `Handle`.
+// Being stateless it can be used as the allocator of bs::stringt.
+template<class T, std::size_t Alignment, class Handle>
+class resource_allocator {
+public:
+    static_assert(detail::is_power_of_two(Alignment), "The alignment must be representable to the power of two");
+
+    using value_type = T;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal = std::true_type;
+
+    template<class U>
+    struct rebind { using other = resource_allocator<U, Alignment, Handle>; };
+
+    constexpr resource_allocator() noexcept = default;
+    constexpr resource_allocator(const resource_allocator&) noexcept = default;
+    template<class U>
+    constexpr resource_allocator(const resource_allocator<U, Alignment, Handle>&) noexcept {}
+
+    static decltype(auto) resource() noexcept {
+        return Handle::resource();
+    }
+
+    T* allocate(const std::size_t n) {
+        if (std::size_t(-1) / sizeof(T) < n) { throw std::bad_array_new_length{}; }
+        return static_cast<T*>(Handle::allocate(sizeof(T) * n, alignment));
+    }
+    void deallocate(T* const ptr, const std::size_t n) noexcept {
+        Handle::deallocate(ptr, sizeof(T) * n, alignment);
+    }
+
+    friend constexpr bool operator==(const resource_allocator&, const resource_allocator&) noexcept { return true; }
+    friend constexpr bool operator!=(const resource_allocator&, const resource_allocator&) noexcept { return false; }
+
+private:
+    static constexpr std::size_t alignment = Alignment < alignof(T) ? alignof(T) : Alignment;
+};
+
+// allocates from a thread-local monotonic_arena, memory is reclaimed by resource().release()
+template<class T, std::size_t Alignment = alignof(T), class Tag = void>
+using monotonic_allocator = resource_allocator<T, Alignment, detail::monotonic_arena_handle<Tag>>;
+
+// allocates from a process-wide string_pool guarded by a mutex
+template<class T, std::size_t Alignment = alignof(T), class Tag = void>
+using pool_allocator = resource_allocator<T, Alignment, shared_string_pool<Tag>>;
+
+// allocates from a per-thread cache backed by the same pool as pool_allocator<T, Alignment, Tag>
+template<class T, std::size_t Alignment = alignof(T), class Tag = void>
+using thread_cache_allocator = resource_allocator<T, Alignment, detail::thread_cache_handle<Tag>>;
+
 }
@@ -0,0 +1,109 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <betterstring/detail/preprocessor.hpp>
+#include <betterstring/type_traits.hpp>
+#include <cstdint>
+
+#if BS_COMP_MSVC
+    #include <intrin.h>
+#endif
+
+namespace bs::detail {
+
+BS_FORCEINLINE
+constexpr int countr_zero(const std::uint64_t x) noexcept {
+    BS_VERIFY(x != 0, "countr_zero of zero is undefined");
+    if (!detail::is_constant_evaluated()) {
+#if BS_COMP_CLANG || BS_COMP_GCC
+        return __builtin_ctzll(x);
+#elif BS_COMP_MSVC && defined(_M_X64)
+        unsigned long index;
+        _BitScanForward64(&index, x);
+        return static_cast<int>(index);
+#endif
+    }
+    int count = 0;
+    while ((x & (std::uint64_t(1) << count)) == 0) { ++count; }
+    return count;
+}
+
+BS_FORCEINLINE
+constexpr int countl_zero(const std::uint64_t x) noexcept {
+    BS_VERIFY(x != 0, "countl_zero of zero is undefined");
+    if (!detail::is_constant_evaluated()) {
+#if BS_COMP_CLANG || BS_COMP_GCC
+        return __builtin_clzll(x);
+#elif BS_COMP_MSVC && defined(_M_X64)
+        unsigned long index;
+        _BitScanReverse64(&index, x);
+        return 63 - static_cast<int>(index);
+#endif
+    }
+    int count = 0;
+    while ((x & (std::uint64_t(1) << (63 - count))) == 0) { ++count; }
+    return count;
+}
+
+BS_FORCEINLINE
+constexpr int popcount(std::uint64_t x) noexcept {
+    if (!detail::is_constant_evaluated()) {
+#if BS_COMP_CLANG || BS_COMP_GCC
+        return __builtin_popcountll(x);
+#endif
+    }
+    int count = 0;
+    while (x != 0) {
+        x &= x - 1;
+        ++count;
+    }
+    return count;
+}
+
+// clears the lowest set bit (blsr)
+BS_FORCEINLINE
+constexpr std::uint64_t clear_lowest_bit(const std::uint64_t x) noexcept {
+    return x & (x - 1);
+}
+
+// number of bits required to represent x, 0 for x == 0
+constexpr int bit_width(const std::uint64_t x) noexcept {
+    if (x == 0) { return 0; }
+    return 64 - detail::countl_zero(x);
+}
+
+// the smallest power of two not less than x, 1 for x == 0
+constexpr std::uint64_t bit_ceil(const std::uint64_t x) noexcept {
+    if (x <= 1) { return 1; }
+    return std::uint64_t(1) << detail::bit_width(x - 1);
+}
+
+// full 128-bit product of a and b, the high half is written into `high`
+BS_FORCEINLINE
+constexpr std::uint64_t umul128(const std::uint64_t a, const std::uint64_t b, std::uint64_t& high) noexcept {
+    if (!detail::is_constant_evaluated()) {
+#if (BS_COMP_CLANG || BS_COMP_GCC) && defined(__SIZEOF_INT128__)
+        __extension__ using uint128 = unsigned __int128;
+        const uint128 product = static_cast<uint128>(a) * b;
+        high = static_cast<std::uint64_t>(product >> 64);
+        return static_cast<std::uint64_t>(product);
+#elif BS_COMP_MSVC && defined(_M_X64)
+        return _umul128(a, b, &high);
+#endif
+    }
+    const std::uint64_t a_low = a & 0xFFFFFFFF;
+    const std::uint64_t a_high = a >> 32;
+    const std::uint64_t b_low = b & 0xFFFFFFFF;
+    const std::uint64_t b_high = b >> 32;
+    const std::uint64_t low_low = a_low * b_low;
+    const std::uint64_t high_low = a_high * b_low;
+    const std::uint64_t low_high = a_low * b_high;
+    const std::uint64_t cross = (low_low >> 32) + (high_low & 0xFFFFFFFF) + low_high;
+    high = a_high * b_high + (high_low >> 32) + (cross >> 32);
+    return (cross << 32) | (low_low & 0xFFFFFFFF);
+}
+
+}
@@ -0,0 +1,94 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <betterstring/detail/preprocessor.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace bs::detail {
+
+inline constexpr char two_digits_table[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+template<class U>
+constexpr std::size_t count_digits(U value) noexcept {
+    static_assert(std::is_unsigned_v<U>);
+    std::size_t count = 1;
+    while (true) {
+        if (value < 10) { return count; }
+        if (value < 100) { return count + 1; }
+        if (value < 1000) { return count + 2; }
+        if (value < 10000) { return count + 3; }
+        value = static_cast<U>(value / 10000u);
+        count += 4;
+    }
+}
+
+// decimal representation of an integer, the length is computed once
+// so that the output buffer can be sized before writing
+template<class T>
+class formatted_integer {
+    using unsigned_type = std::make_unsigned_t<T>;
+public:
+    constexpr explicit formatted_integer(const T value) noexcept
+        : magnitude(static_cast<unsigned_type>(value)), negative(false) {
+        if constexpr (std::is_signed_v<T>) {
+            if (value < 0) {
+                // negate in unsigned arithmetic to handle the minimum value
+                magnitude = static_cast<unsigned_type>(unsigned_type(0) - magnitude);
+                negative = true;
+            }
+        }
+        digits = detail::count_digits(magnitude);
+    }
+
+    constexpr std::size_t size() const noexcept {
+        return digits + (negative ? 1 : 0);
+    }
+
+    // writes exactly size() characters, returns the end of the written range
+    template<class Ch>
+    constexpr Ch* write(Ch* const dest) const noexcept {
+        Ch* out = dest + size();
+        Ch* const end = out;
+        unsigned_type value = magnitude;
+        while (value >= 100) {
+            const std::size_t index = static_cast<std::size_t>(value % 100) * 2;
+            value /= 100;
+            *--out = static_cast<Ch>(two_digits_table[index + 1]);
+            *--out = static_cast<Ch>(two_digits_table[index]);
+        }
+        if (value >= 10) {
+            const std::size_t index = static_cast<std::size_t>(value) * 2;
+            *--out = static_cast<Ch>(two_digits_table[index + 1]);
+            *--out = static_cast<Ch>(two_digits_table[index]);
+        } else {
+            *--out = static_cast<Ch>('0' + static_cast<char>(value));
+        }
+        if (negative) {
+            *--out = static_cast<Ch>('-');
+        }
+        BS_VERIFY(out == dest, "written integer length does not match computed length");
+        return end;
+    }
+
+private:
+    unsigned_type magnitude;
+    bool negative;
+    std::size_t digits = 0;
+};
+
+}
@@ -0,0 +1,59 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <betterstring/detail/preprocessor.hpp>
+#include <betterstring/type_traits.hpp>
+#include <betterstring/char_traits.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define BS_HAS_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define BS_HAS_SSE2 0
+#endif
+
+namespace bs::detail {
+
+// the number of characters compared at once, one bit of the mask per character
+inline constexpr std::size_t match_block_size = 64;
+
+#if BS_HAS_SSE2
+BS_FORCEINLINE
+inline std::uint64_t match_mask_sse2(const char* const block, const char ch) noexcept {
+    const __m128i needle = _mm_set1_epi8(ch);
+    const auto mask_16 = [needle](const char* const ptr) {
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+        return static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, needle))));
+    };
+    return mask_16(block) | (mask_16(block + 16) << 16) | (mask_16(block + 32) << 32) | (mask_16(block + 48) << 48);
+}
+#endif
+
+// bit `i` of the result is set if `block[i]` is equal to `ch`, only the first `count` (<= 64) characters are compared
+template<class Traits>
+BS_FORCEINLINE
+constexpr std::uint64_t match_mask(const typename Traits::char_type* const block, const std::size_t count, const typename Traits::char_type ch) noexcept {
+    BS_VERIFY(count <= match_block_size, "the block is larger than the mask");
+#if BS_HAS_SSE2
+    if (!detail::is_constant_evaluated()) {
+        if constexpr (std::is_same_v<Traits, bs::char_traits<char>>) {
+            if (count == match_block_size) {
+                return detail::match_mask_sse2(block, ch);
+            }
+        }
+    }
+#endif
+    std::uint64_t mask = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        mask |= static_cast<std::uint64_t>(Traits::eq(block[i], ch)) << i;
+    }
+    return mask;
+}
+
+}
@@ -0,0 +1,195 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <betterstring/detail/preprocessor.hpp>
+#include <betterstring/detail/bit.hpp>
+#include <betterstring/detail/integer_cmps.hpp>
+#include <betterstring/detail/match_mask.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+namespace bs {
+
+namespace detail {
+    // Iterates over the positions of the matches, a block of up to 64 candidate positions
+    // is compared at once and the resulting bitmask is drained before loading the next block.
+    template<class String, class Needle>
+    class found_positions_iterator {
+        static constexpr bool is_char_needle = !std::is_same_v<Needle, String>;
+        using traits_type = typename String::traits_type;
+    public:
+        // iterator traits
+        using difference_type = std::ptrdiff_t;
+        using value_type = typename String::size_type;
+        using size_type = typename String::size_type;
+        using reference = value_type;
+        using pointer = void;
+        using iterator_category = std::input_iterator_tag;
+
+        struct end_tag {};
+
+        constexpr found_positions_iterator(const String str_, const Needle needle_) noexcept
+            : str{str_}, needle{needle_} {
+            if constexpr (!is_char_needle) {
+                BS_VERIFY(needle.size() != 0, "searched string is empty");
+            }
+            const size_type len = needle_size();
+            search_size = str.size() >= len ? str.size() - len + 1 : 0;
+            load_block(0);
+            settle();
+        }
+        // the end iterator, does not search the string
+        constexpr found_positions_iterator(const String str_, const Needle needle_, end_tag) noexcept
+            : str{str_}, needle{needle_} {}
+
+        constexpr size_type operator*() const noexcept {
+            BS_VERIFY(mask != 0, "dereferencing the end iterator");
+            return block + static_cast<size_type>(detail::countr_zero(mask));
+        }
+
+        constexpr found_positions_iterator& operator++() noexcept {
+            BS_VERIFY(mask != 0, "incrementing the end iterator");
+            if constexpr (is_char_needle) {
+                mask = detail::clear_lowest_bit(mask);
+            } else {
+                // the matches do not overlap, the search continues after the end of the match
+                const size_type next = **this + needle.size();
+                const size_type offset = next - block;
+                if (offset >= match_block_size) {
+                    load_block(next);
+                } else {
+                    mask &= ~((std::uint64_t(1) << offset) - 1);
+                }
+            }
+            settle();
+            return *this;
+        }
+        constexpr found_positions_iterator operator++(int) noexcept {
+            auto tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        constexpr bool operator!=(const found_positions_iterator&) const noexcept {
+            return mask != 0;
+        }
+        constexpr bool operator==(const found_positions_iterator&) const noexcept {
+            return mask == 0;
+        }
+
+        // Writes the positions of at most `capacity` following matches into `out`, returns the number of written positions.
+        // The iterator is advanced past the written matches, so the next call continues the search.
+        template<class Int>
+        constexpr std::size_t positions_into(Int* const out, const std::size_t capacity) noexcept {
+            static_assert(std::is_integral_v<Int> && std::is_unsigned_v<Int>, "positions are written into an unsigned integer buffer");
+            BS_VERIFY(str.size() == 0 || detail::cmp_less_equal(str.size() - 1, (std::numeric_limits<Int>::max)()), "the positions do not fit into the integer type");
+            std::size_t written = 0;
+            if constexpr (is_char_needle) {
+                while (written < capacity && mask != 0) {
+                    // drain the mask of the current block without checking for the end of the string
+                    do {
+                        out[written++] = static_cast<Int>(block + static_cast<size_type>(detail::countr_zero(mask)));
+                        mask = detail::clear_lowest_bit(mask);
+                    } while (mask != 0 && written < capacity);
+                    settle();
+                }
+            } else {
+                while (written < capacity && mask != 0) {
+                    out[written++] = static_cast<Int>(**this);
+                    ++(*this);
+                }
+            }
+            return written;
+        }
+
+    private:
+        constexpr size_type needle_size() const noexcept {
+            if constexpr (is_char_needle) {
+                return 1;
+            } else {
+                return needle.size();
+            }
+        }
+
+        // loads the mask of candidates [position, position + 64)
+        constexpr void load_block(const size_type position) noexcept {
+            block = position;
+            if (position >= search_size) {
+                mask = 0;
+                return;
+            }
+            const size_type remaining = search_size - position;
+            const std::size_t count = remaining < match_block_size ? static_cast<std::size_t>(remaining) : match_block_size;
+            const auto* const first = str.data() + position;
+            if constexpr (is_char_needle) {
+                mask = detail::match_mask<traits_type>(first, count, needle);
+            } else {
+                // both the first and the last characters of the needle must match,
+                // all of the compared characters are inside of the string
+                const size_type last = needle.size() - 1;
+                mask = detail::match_mask<traits_type>(first, count, needle[0])
+                    & detail::match_mask<traits_type>(first + last, count, needle[last]);
+            }
+        }
+
+        // moves to the next match, the mask is zero only at the end
+        constexpr void settle() noexcept {
+            while (true) {
+                if constexpr (!is_char_needle) {
+                    // the candidates of 1 and 2 character needles are already exact
+                    while (mask != 0 && needle.size() > 2) {
+                        const size_type candidate = block + static_cast<size_type>(detail::countr_zero(mask));
+                        if (traits_type::compare(str.data() + candidate + 1, needle.data() + 1, needle.size() - 2) == 0) {
+                            return;
+                        }
+                        mask = detail::clear_lowest_bit(mask);
+                    }
+                }
+                if (mask != 0) { return; }
+                const size_type next = block + match_block_size;
+                if (next >= search_size) { return; }
+                load_block(next);
+            }
+        }
+
+        String str;
+        Needle needle;
+        size_type search_size{};
+        size_type block{};
+        std::uint64_t mask{};
+    };
+}
+
+template<class String, class Needle>
+struct found_positions {
+public:
+    using needle_type = Needle;
+    using string_type = String;
+    using size_type = typename string_type::size_type;
+    using iterator = detail::found_positions_iterator<string_type, needle_type>;
+    using const_iterator = iterator;
+
+    constexpr found_positions(string_type str, needle_type needle_) noexcept
+        : string(str), needle(needle_) {}
+
+    constexpr iterator begin() const noexcept { return iterator{string, needle}; }
+    constexpr iterator end() const noexcept { return iterator{string, needle, typename iterator::end_tag{}}; }
+
+    // Writes the positions of the first `capacity` matches into `out`, returns the number of written positions.
+    template<class Int>
+    constexpr std::size_t positions_into(Int* const out, const std::size_t capacity) const noexcept {
+        return begin().positions_into(out, capacity);
+    }
+
+private:
+    string_type string;
+    needle_type needle;
+};
+
+}
@@ -106,6 +106,15 @@ template<class T>
 constexpr void strcopy(T* const dest, const T* const src, const std::size_t count) noexcept {
     BS_VERIFY(dest != nullptr, "dest or src is null pointer");
     BS_VERIFY(src != nullptr, "src is null pointer");
+#if BS_COMP_GCC
+    // GCC evaluates the memory builtins in constant expressions only for string literals
+    if (detail::is_constant_evaluated()) {
+        for (std::size_t i = 0; i < count; ++i) {
+            dest[i] = src[i];
+        }
+        return;
+    }
+#endif
 #if BS_HAS_BUILTIN(__builtin_wmemcpy)
     if constexpr (std::is_same_v<T, wchar_t>) {
         __builtin_wmemcpy(dest, src, count);
@@ -136,6 +145,18 @@ constexpr int strcomp(const T* const left, const T* const right, const std::size
     if (count == 0) { return 0; }
     BS_VERIFY(left != nullptr, "left is null pointer");
     BS_VERIFY(right != nullptr, "right is null pointer");
+#if BS_COMP_GCC
+    // GCC evaluates the memory builtins in constant expressions only for string literals
+    // and the characters are compared as unsigned like `__builtin_memcmp` does, `__builtin_wmemcmp` compares `wchar_t`
+    if (detail::is_constant_evaluated()) {
+        using compared_type = std::conditional_t<std::is_same_v<T, wchar_t>, T, std::make_unsigned_t<T>>;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (static_cast<compared_type>(left[i]) < static_cast<compared_type>(right[i])) { return -1; }
+            if (static_cast<compared_type>(left[i]) > static_cast<compared_type>(right[i])) { return 1; }
+        }
+        return 0;
+    }
+#endif
 #if BS_HAS_BUILTIN(__builtin_wmemcmp) || defined(_MSC_VER)
     if constexpr (std::is_same_v<T, wchar_t>) {
         return __builtin_wmemcmp(left, right, count);
@@ -290,6 +311,15 @@ constexpr T* strrfind(T* const str, const std::size_t count, const detail::type_
 template<class T>
 constexpr void strfill(T* const dest, const std::size_t count, const detail::type_identity_t<T> ch) noexcept {
     BS_VERIFY(dest != nullptr, "dest is null pointer");
+#if BS_COMP_GCC
+    // GCC evaluates the memory builtins in constant expressions only for string literals
+    if (detail::is_constant_evaluated()) {
+        for (std::size_t i = 0; i < count; ++i) {
+            dest[i] = ch;
+        }
+        return;
+    }
+#endif
 #if BS_HAS_BUILTIN(__builtin_wmemset) && (defined(__GNUC__) || defined(__GNUG__)) && !defined(__clang__)
     if constexpr (std::is_same_v<T, wchar_t>) {
         __builtin_wmemset(dest, ch, count);
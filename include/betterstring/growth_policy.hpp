@@ -0,0 +1,63 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <betterstring/detail/preprocessor.hpp>
+#include <betterstring/detail/bit.hpp>
+#include <type_traits>
+
+// Growth policies compute the capacity that bs::stringt allocates when
+// `required` characters do not fit into the current buffer.
+// A policy is selected through the `growth_policy` member type of the traits.
+
+namespace bs::growth {
+
+struct exact {
+    template<class Size>
+    static constexpr Size capacity(const Size required) noexcept {
+        return required;
+    }
+};
+
+struct one_and_half {
+    template<class Size>
+    static constexpr Size capacity(const Size required) noexcept {
+        const Size new_cap = required + required / 2;
+        // if overflows
+        if (new_cap < required) { return Size(-1); }
+        return new_cap;
+    }
+};
+
+struct doubling {
+    template<class Size>
+    static constexpr Size capacity(const Size required) noexcept {
+        const Size new_cap = required * 2;
+        // if overflows
+        if (new_cap < required) { return Size(-1); }
+        return new_cap;
+    }
+};
+
+// rounds up to the power of two, which matches the size classes of bs::string_pool
+struct power_of_two {
+    template<class Size>
+    static constexpr Size capacity(const Size required) noexcept {
+        static_assert(std::is_unsigned_v<Size>);
+        if (required > (Size(-1) >> 1)) { return Size(-1); }
+        return static_cast<Size>(detail::bit_ceil(required));
+    }
+};
+
+}
+
+namespace bs::detail {
+    template<class Traits, class = void>
+    struct traits_growth_policy { using type = bs::growth::doubling; };
+    template<class Traits>
+    struct traits_growth_policy<Traits, std::void_t<typename Traits::growth_policy>> {
+        using type = typename Traits::growth_policy;
+    };
+}
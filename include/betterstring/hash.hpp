@@ -0,0 +1,203 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <betterstring/string.hpp>
+#include <betterstring/string_view.hpp>
+#include <betterstring/ascii.hpp>
+#include <betterstring/type_traits.hpp>
+#include <betterstring/detail/preprocessor.hpp>
+#include <betterstring/detail/bit.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+namespace bs {
+
+namespace detail {
+    // sets the bit 5 of every byte in the range 'A'..'Z'
+    constexpr std::uint64_t ascii_lowercase_word(const std::uint64_t word) noexcept {
+        constexpr std::uint64_t ones = 0x0101010101010101;
+        const std::uint64_t heptets = word & (0x7F * ones);
+        const std::uint64_t not_less_a = heptets + (0x80 - 'A') * ones;
+        const std::uint64_t greater_z = heptets + (0x80 - 'Z' - 1) * ones;
+        const std::uint64_t uppercase = not_less_a & ~greater_z & ~word & (0x80 * ones);
+        return word | (uppercase >> 2);
+    }
+
+    // Reads the bytes of the characters, in little endian order in constant evaluation.
+    template<class Char, bool AsciiLowercase>
+    struct hash_reader {
+        using unsigned_char = std::make_unsigned_t<Char>;
+        static constexpr bool single_byte = sizeof(Char) == 1;
+
+        constexpr std::uint64_t byte(const std::size_t offset) const noexcept {
+            Char ch = chars[offset / sizeof(Char)];
+            if constexpr (AsciiLowercase) {
+                ch = bs::ascii::to_lowercase(ch);
+            }
+            return (static_cast<std::uint64_t>(static_cast<unsigned_char>(ch)) >> (offset % sizeof(Char) * 8)) & 0xFF;
+        }
+
+        template<std::size_t N>
+        BS_FORCEINLINE
+        constexpr std::uint64_t read(const std::size_t offset) const noexcept {
+            if constexpr (single_byte || !AsciiLowercase) {
+                if (!detail::is_constant_evaluated()) {
+                    return load<N>(offset);
+                }
+            }
+            std::uint64_t value = 0;
+            for (std::size_t i = 0; i < N; ++i) {
+                value |= byte(offset + i) << (i * 8);
+            }
+            return value;
+        }
+
+        template<std::size_t N>
+        BS_FORCEINLINE
+        std::uint64_t load(const std::size_t offset) const noexcept {
+            std::conditional_t<N == 8, std::uint64_t, std::uint32_t> value;
+            std::memcpy(&value, reinterpret_cast<const unsigned char*>(chars) + offset, N);
+            if constexpr (AsciiLowercase) {
+                return detail::ascii_lowercase_word(value);
+            } else {
+                return value;
+            }
+        }
+
+        const Char* chars;
+    };
+
+    BS_FORCEINLINE
+    constexpr std::uint64_t wymix(const std::uint64_t a, const std::uint64_t b) noexcept {
+        std::uint64_t high = 0;
+        const std::uint64_t low = detail::umul128(a, b, high);
+        return low ^ high;
+    }
+
+    // wyhash (final version 4)
+    template<class Reader>
+    constexpr std::uint64_t wyhash(const Reader input, const std::size_t len, std::uint64_t seed) noexcept {
+        constexpr std::uint64_t secret[4] = {0x2d358dccaa6c78a5, 0x8bb84b93962eacc9, 0x4b33a62ed433d4a3, 0x4d5a2da51de1aa47};
+
+        seed ^= detail::wymix(seed ^ secret[0], secret[1]);
+        std::uint64_t a = 0;
+        std::uint64_t b = 0;
+        if (len <= 16) {
+            if (len >= 4) {
+                const std::size_t shift = (len >> 3) << 2;
+                a = (input.template read<4>(0) << 32) | input.template read<4>(shift);
+                b = (input.template read<4>(len - 4) << 32) | input.template read<4>(len - 4 - shift);
+            } else if (len > 0) {
+                a = (input.byte(0) << 16) | (input.byte(len >> 1) << 8) | input.byte(len - 1);
+            }
+        } else {
+            std::size_t position = 0;
+            std::size_t rest = len;
+            if (rest >= 48) {
+                // three independent multiplication chains
+                std::uint64_t seed1 = seed;
+                std::uint64_t seed2 = seed;
+                do {
+                    seed = detail::wymix(input.template read<8>(position) ^ secret[1], input.template read<8>(position + 8) ^ seed);
+                    seed1 = detail::wymix(input.template read<8>(position + 16) ^ secret[2], input.template read<8>(position + 24) ^ seed1);
+                    seed2 = detail::wymix(input.template read<8>(position + 32) ^ secret[3], input.template read<8>(position + 40) ^ seed2);
+                    position += 48;
+                    rest -= 48;
+                } while (rest >= 48);
+                seed ^= seed1 ^ seed2;
+            }
+            while (rest > 16) {
+                seed = detail::wymix(input.template read<8>(position) ^ secret[1], input.template read<8>(position + 8) ^ seed);
+                position += 16;
+                rest -= 16;
+            }
+            a = input.template read<8>(position + rest - 16);
+            b = input.template read<8>(position + rest - 8);
+        }
+        a ^= secret[1];
+        b ^= seed;
+        std::uint64_t high = 0;
+        a = detail::umul128(a, b, high);
+        b = high;
+        return detail::wymix(a ^ secret[0] ^ len, b ^ secret[1]);
+    }
+}
+
+// Returns the 64-bit hash of the characters of `str` (wyhash).
+// The hash is the same in constant evaluation and at runtime on little endian platforms.
+template<class Traits = char_traits<char>>
+constexpr std::uint64_t hash_string(const detail::type_identity_t<bs::string_viewt<Traits>> str, const std::uint64_t seed = 0) noexcept {
+    using char_type = typename Traits::char_type;
+    return detail::wyhash(detail::hash_reader<char_type, false>{str.data()}, str.size() * sizeof(char_type), seed);
+}
+
+// Returns the hash of `str` with ASCII uppercase letters replaced by lowercase ones,
+// strings equal ignoring the ASCII case have the same hash.
+template<class Traits = char_traits<char>>
+constexpr std::uint64_t hash_string_ascii_icase(const detail::type_identity_t<bs::string_viewt<Traits>> str, const std::uint64_t seed = 0) noexcept {
+    using char_type = typename Traits::char_type;
+    static_assert(bs::is_ascii_compatible<char_type>, "the character type must be ASCII compatible");
+    return detail::wyhash(detail::hash_reader<char_type, true>{str.data()}, str.size() * sizeof(char_type), seed);
+}
+
+template<class T>
+struct hash;
+
+template<class Traits>
+struct hash<bs::string_viewt<Traits>> {
+    using is_transparent = void;
+
+    constexpr std::size_t operator()(const bs::string_viewt<Traits> str) const noexcept {
+        return static_cast<std::size_t>(bs::hash_string<Traits>(str));
+    }
+};
+template<class Traits>
+struct hash<bs::stringt<Traits>> : hash<bs::string_viewt<Traits>> {};
+
+// Hash which ignores the ASCII case, for use with `ascii_icase_equal_to`.
+template<class T>
+struct ascii_icase_hash;
+
+template<class Traits>
+struct ascii_icase_hash<bs::string_viewt<Traits>> {
+    using is_transparent = void;
+
+    constexpr std::size_t operator()(const bs::string_viewt<Traits> str) const noexcept {
+        return static_cast<std::size_t>(bs::hash_string_ascii_icase<Traits>(str));
+    }
+};
+template<class Traits>
+struct ascii_icase_hash<bs::stringt<Traits>> : ascii_icase_hash<bs::string_viewt<Traits>> {};
+
+template<class T>
+struct ascii_icase_equal_to;
+
+template<class Traits>
+struct ascii_icase_equal_to<bs::string_viewt<Traits>> {
+    using is_transparent = void;
+
+    constexpr bool operator()(const bs::string_viewt<Traits> left, const bs::string_viewt<Traits> right) const noexcept {
+        if (left.size() != right.size()) { return false; }
+        for (std::size_t i = 0; i < left.size(); ++i) {
+            if (bs::ascii::to_lowercase(left[i]) != bs::ascii::to_lowercase(right[i])) { return false; }
+        }
+        return true;
+    }
+};
+template<class Traits>
+struct ascii_icase_equal_to<bs::stringt<Traits>> : ascii_icase_equal_to<bs::string_viewt<Traits>> {};
+
+}
+
+namespace std {
+    template<class Traits>
+    struct hash<bs::string_viewt<Traits>> : bs::hash<bs::string_viewt<Traits>> {};
+    template<class Traits>
+    struct hash<bs::stringt<Traits>> : bs::hash<bs::stringt<Traits>> {};
+}
@@ -0,0 +1,405 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <betterstring/char_traits.hpp>
+#include <betterstring/string_view.hpp>
+#include <betterstring/hash.hpp>
+#include <betterstring/type_traits.hpp>
+#include <betterstring/detail/preprocessor.hpp>
+#include <betterstring/detail/integer_cmps.hpp>
+#include <betterstring/detail/reference_wrapper.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace bs {
+
+// The overflow policies of `inline_string`, used when the result does not fit into the capacity.
+// Throws `std::length_error`.
+struct overflow_throw {};
+// Keeps the first characters which fit.
+struct overflow_truncate {};
+
+namespace detail {
+    // the bytes of the size of the inline string: the smallest unsigned type which holds `N`, but not narrower than `Char`
+    template<std::size_t N, class Char>
+    inline constexpr std::size_t inline_size_bytes = (N <= 0xFF ? 1 : N <= 0xFFFF ? 2 : 4) > sizeof(Char)
+        ? (N <= 0xFF ? 1 : N <= 0xFFFF ? 2 : 4) : sizeof(Char);
+
+    template<std::size_t N, class Char>
+    using inline_size_t = std::conditional_t<inline_size_bytes<N, Char> == 1, std::uint8_t,
+        std::conditional_t<inline_size_bytes<N, Char> == 2, std::uint16_t,
+        std::conditional_t<inline_size_bytes<N, Char> == 4, std::uint32_t, std::uint64_t>>>;
+
+    // the characters fill the object up to a multiple of the size, so the inline string has no padding bytes
+    template<std::size_t N, class Char>
+    inline constexpr std::size_t inline_chars_length = ((N == 0 ? 1 : N) * sizeof(Char) + inline_size_bytes<N, Char> - 1)
+        / inline_size_bytes<N, Char> * inline_size_bytes<N, Char> / sizeof(Char);
+}
+
+// String of at most `N` characters stored entirely inside of the object, it never allocates.
+// The string is trivially copyable, and the characters after the end of the string are always zero.
+// The object has no padding bytes, so equal strings have equal object representations
+// and the string can be a non-type template parameter in C++20.
+template<std::size_t N, class Char = char, class OverflowPolicy = overflow_throw>
+class inline_string {
+    static_assert(N <= 0xFFFFFFFF, "the capacity of the inline string is too large");
+    static_assert(std::is_same_v<OverflowPolicy, overflow_throw> || std::is_same_v<OverflowPolicy, overflow_truncate>,
+        "the overflow policy must be bs::overflow_throw or bs::overflow_truncate");
+public:
+    using traits_type = char_traits<Char>;
+    using value_type = Char;
+    using size_type = typename traits_type::size_type;
+
+    using pointer = value_type*;
+    using const_pointer = const value_type*;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using iterator = value_type*;
+    using const_iterator = const value_type*;
+
+    using overflow_policy = OverflowPolicy;
+private:
+    using self_string_view = bs::string_viewt<traits_type>;
+    using optional_char_reference = std::optional<detail::reference_wrapper<value_type>>;
+    using optional_char_const_reference = std::optional<detail::reference_wrapper<const value_type>>;
+public:
+
+    constexpr inline_string() noexcept = default;
+
+    constexpr inline_string(const const_pointer str, const size_type str_len) {
+        append(str, str_len);
+    }
+    explicit constexpr inline_string(const self_string_view str_view) {
+        append(str_view.data(), str_view.size());
+    }
+    // Not explicit, so that a literal can be the argument of an inline string template parameter.
+    template<std::size_t M>
+    constexpr inline_string(const value_type (&str)[M]) {
+        static_assert(M != 0, "given non-null terminated array");
+        size_type count = M - 1;
+        if (count > N) {
+            overflow();
+            count = N;
+        }
+        // plain loop, GCC does not evaluate the null pointer checks of `append` while converting a template argument
+        for (size_type i = 0; i < count; ++i) {
+            chars[i] = str[i];
+        }
+        char_count = static_cast<detail::inline_size_t<N, Char>>(count);
+    }
+
+    [[nodiscard]] static constexpr inline_string filled(const value_type ch, const size_type count) {
+        inline_string out;
+        out.resize(count, ch);
+        return out;
+    }
+    [[nodiscard]] static constexpr inline_string from_c_string(const const_pointer c_str) {
+        BS_VERIFY(c_str != nullptr, "c_str is null pointer");
+        return inline_string{c_str, traits_type::length(c_str)};
+    }
+    static constexpr inline_string from_c_string(std::nullptr_t) = delete;
+
+    constexpr inline_string& operator=(const self_string_view str_view) {
+        replace_range(0, size(), str_view.data(), str_view.size());
+        return *this;
+    }
+
+    static constexpr size_type capacity() noexcept { return N; }
+    static constexpr size_type max_size() noexcept { return N; }
+
+    constexpr void clear() noexcept {
+        traits_type::assign(chars, char_count, value_type());
+        char_count = 0;
+    }
+
+    constexpr void push_back(const value_type ch) {
+        if (char_count == N) {
+            overflow();
+            return;
+        }
+        chars[char_count] = ch;
+        ++char_count;
+    }
+    constexpr void pop_back() noexcept {
+        BS_VERIFY(size() != 0, "cannot remove the last character from an empty string");
+        --char_count;
+        chars[char_count] = value_type();
+    }
+
+    constexpr void append(const const_pointer str, const size_type str_len) {
+        size_type count = str_len;
+        if (count > N - char_count) {
+            overflow();
+            count = N - char_count;
+        }
+        // the appended characters can be a part of the string, the copy does not overlap them
+        traits_type::copy(chars + char_count, str, count);
+        char_count = static_cast<detail::inline_size_t<N, Char>>(char_count + count);
+    }
+    constexpr void append(const self_string_view str_view) {
+        append(str_view.data(), str_view.size());
+    }
+    constexpr inline_string& operator+=(const self_string_view str_view) {
+        append(str_view.data(), str_view.size());
+        return *this;
+    }
+    constexpr inline_string& operator+=(const value_type ch) {
+        push_back(ch);
+        return *this;
+    }
+
+    constexpr void insert(const size_type position, const self_string_view str_view) {
+        replace_range(position, 0, str_view.data(), str_view.size());
+    }
+    constexpr void insert(const size_type position, const value_type ch) {
+        replace_range(position, 0, &ch, 1);
+    }
+
+    constexpr void erase(const size_type position) noexcept {
+        BS_VERIFY(position <= size(), "the erase position exceeds the length of the string");
+        traits_type::assign(chars + position, char_count - position, value_type());
+        char_count = static_cast<detail::inline_size_t<N, Char>>(position);
+    }
+    constexpr void erase(const size_type position, const size_type count) noexcept {
+        BS_VERIFY(position <= size(), "the erase position exceeds the length of the string");
+        BS_VERIFY(count <= size() - position, "the erased range exceeds the length of the string");
+        const size_type old_size = size();
+        traits_type::move(chars + position, chars + position + count, old_size - position - count);
+        traits_type::assign(chars + old_size - count, count, value_type());
+        char_count = static_cast<detail::inline_size_t<N, Char>>(old_size - count);
+    }
+
+    // Replaces [position, position + count) with `str_view`, which may refer to the string itself.
+    constexpr void replace(const size_type position, const size_type count, const self_string_view str_view) {
+        replace_range(position, count, str_view.data(), str_view.size());
+    }
+
+    constexpr void resize(const size_type count) {
+        resize(count, value_type());
+    }
+    constexpr void resize(const size_type count, const value_type ch) {
+        if (count > N) {
+            overflow();
+            resize(N, ch);
+            return;
+        }
+        const size_type old_size = size();
+        if (count <= old_size) {
+            erase(count);
+            return;
+        }
+        traits_type::assign(chars + old_size, count - old_size, ch);
+        char_count = static_cast<detail::inline_size_t<N, Char>>(count);
+    }
+
+    constexpr void remove_prefix_inplace(const size_type count) noexcept {
+        BS_VERIFY(count <= size(), "the removed prefix exceeds the length of the string");
+        erase(0, count);
+    }
+
+    // Resizes the string to at most `count` characters, letting `op` write directly into the buffer.
+    // `op(data(), count)` must return the new size of the string, that is not greater than `count`.
+    template<class Operation>
+    constexpr void resize_and_overwrite(size_type count, Operation op) {
+        if (count > N) {
+            overflow();
+            count = N;
+        }
+        const auto new_size = std::move(op)(chars, count);
+        BS_VERIFY(detail::cmp_greater_equal(new_size, 0) && detail::cmp_less_equal(new_size, count), "the operation returned size outside the range [0, count]");
+        const size_type end = count > char_count ? count : char_count;
+        traits_type::assign(chars + new_size, end - static_cast<size_type>(new_size), value_type());
+        char_count = static_cast<detail::inline_size_t<N, Char>>(new_size);
+    }
+
+    constexpr self_string_view substr(const size_type position) const noexcept BS_LIFETIMEBOUND {
+        BS_VERIFY(position <= size(), "the start position of the substring exceeds the length of the string");
+        return self_string_view{data() + position, size() - position};
+    }
+    constexpr self_string_view substr(const size_type position, const size_type count) const noexcept BS_LIFETIMEBOUND {
+        BS_VERIFY(position <= size(), "the start position of the substring exceeds the length of the string");
+        BS_VERIFY(count <= size() - position, "the length of substring exceeds the length of the string");
+        return self_string_view{data() + position, count};
+    }
+
+    constexpr bool contains(const value_type ch) const noexcept {
+        return traits_type::find(data(), size(), ch) != nullptr;
+    }
+    constexpr bool contains(const self_string_view str) const noexcept {
+        return traits_type::findstr(data(), size(), str.data(), str.size()) != nullptr;
+    }
+
+    constexpr bool starts_with(const value_type ch) const noexcept {
+        if (size() == 0) { return false; }
+        return traits_type::eq(data()[0], ch);
+    }
+    constexpr bool starts_with(const self_string_view str) const noexcept {
+        if (size() < str.size()) { return false; }
+        return traits_type::compare(data(), str.data(), str.size()) == 0;
+    }
+
+    constexpr bool ends_with(const value_type ch) const noexcept {
+        if (size() == 0) { return false; }
+        return traits_type::eq(data()[size() - 1], ch);
+    }
+    constexpr bool ends_with(const self_string_view str) const noexcept {
+        if (size() < str.size()) { return false; }
+        return traits_type::compare(data() + (size() - str.size()), str.data(), str.size()) == 0;
+    }
+
+    constexpr pointer data() noexcept BS_LIFETIMEBOUND { return chars; }
+    constexpr const_pointer data() const noexcept BS_LIFETIMEBOUND { return chars; }
+
+    constexpr size_type size() const noexcept { return char_count; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return char_count == 0; }
+
+    constexpr iterator begin() noexcept BS_LIFETIMEBOUND { return data(); }
+    constexpr const_iterator begin() const noexcept BS_LIFETIMEBOUND { return data(); }
+    constexpr iterator end() noexcept BS_LIFETIMEBOUND { return data() + size(); }
+    constexpr const_iterator end() const noexcept BS_LIFETIMEBOUND { return data() + size(); }
+
+    template<class Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+    constexpr const_reference operator[](const Int index) const noexcept BS_LIFETIMEBOUND {
+        BS_VERIFY((index + Int(size())) >= 0 && index < Int(size()), "index is out of range");
+        return data()[index < 0 ? index + Int(size()) : index];
+    }
+    template<class Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+    constexpr reference operator[](const Int index) noexcept BS_LIFETIMEBOUND {
+        BS_VERIFY((index + Int(size())) >= 0 && index < Int(size()), "index is out of range");
+        return data()[index < 0 ? index + Int(size()) : index];
+    }
+
+    template<class Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+    constexpr optional_char_const_reference at(const Int index) const noexcept BS_LIFETIMEBOUND {
+        if (index + Int(size()) < 0 || index >= Int(size())) {
+            return std::nullopt;
+        }
+        return data()[index < 0 ? index + Int(size()) : index];
+    }
+    template<class Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+    constexpr optional_char_reference at(const Int index) noexcept BS_LIFETIMEBOUND {
+        if (index + Int(size()) < 0 || index >= Int(size())) {
+            return std::nullopt;
+        }
+        return data()[index < 0 ? index + Int(size()) : index];
+    }
+
+    constexpr const_reference front() const noexcept BS_LIFETIMEBOUND {
+        BS_VERIFY(size() >= 1, "cannot access the first element from an empty string");
+        return data()[0];
+    }
+    constexpr reference front() noexcept BS_LIFETIMEBOUND {
+        BS_VERIFY(size() >= 1, "cannot access the first element from an empty string");
+        return data()[0];
+    }
+    constexpr const_reference back() const noexcept BS_LIFETIMEBOUND {
+        BS_VERIFY(size() >= 1, "cannot access the last element from an empty string");
+        return data()[size() - 1];
+    }
+    constexpr reference back() noexcept BS_LIFETIMEBOUND {
+        BS_VERIFY(size() >= 1, "cannot access the last element from an empty string");
+        return data()[size() - 1];
+    }
+
+    constexpr optional_char_const_reference at_front() const noexcept BS_LIFETIMEBOUND {
+        if (size() == 0) { return std::nullopt; }
+        return data()[0];
+    }
+    constexpr optional_char_reference at_front() noexcept BS_LIFETIMEBOUND {
+        if (size() == 0) { return std::nullopt; }
+        return data()[0];
+    }
+    constexpr optional_char_const_reference at_back() const noexcept BS_LIFETIMEBOUND {
+        if (size() == 0) { return std::nullopt; }
+        return data()[size() - 1];
+    }
+    constexpr optional_char_reference at_back() noexcept BS_LIFETIMEBOUND {
+        if (size() == 0) { return std::nullopt; }
+        return data()[size() - 1];
+    }
+
+    constexpr operator bs::string_viewt<traits_type>() const noexcept BS_LIFETIMEBOUND {
+        return bs::string_viewt<traits_type>{data(), size()};
+    }
+
+    friend constexpr bool operator==(const inline_string& left, const inline_string& right) noexcept {
+        return left.char_count == right.char_count && equal_chars(left.chars, right.chars, left.char_count);
+    }
+    friend constexpr bool operator!=(const inline_string& left, const inline_string& right) noexcept {
+        return !(left == right);
+    }
+    friend constexpr bool operator==(const inline_string& left, const self_string_view right) noexcept {
+        return left.size() == right.size() && equal_chars(left.chars, right.data(), right.size());
+    }
+    friend constexpr bool operator==(const self_string_view left, const inline_string& right) noexcept {
+        return right == left;
+    }
+    friend constexpr bool operator!=(const inline_string& left, const self_string_view right) noexcept {
+        return !(left == right);
+    }
+    friend constexpr bool operator!=(const self_string_view left, const inline_string& right) noexcept {
+        return !(right == left);
+    }
+
+    // The members are public only because a non-type template parameter can not have private members.
+    // The characters after [0, size()) are always zero, the array is longer than `N` when it fills the padding.
+    value_type chars[detail::inline_chars_length<N, Char>]{};
+    detail::inline_size_t<N, Char> char_count = 0;
+
+private:
+    constexpr void overflow() const {
+        if constexpr (std::is_same_v<OverflowPolicy, overflow_throw>) {
+            throw std::length_error("the inline string capacity is exceeded");
+        }
+    }
+
+    // GCC does not evaluate the null pointer checks of `traits_type::compare` on a template parameter object
+    static constexpr bool equal_chars(const const_pointer left, const const_pointer right, const size_type count) noexcept {
+        if (detail::is_constant_evaluated()) {
+            for (size_type i = 0; i < count; ++i) {
+                if (!traits_type::eq(left[i], right[i])) { return false; }
+            }
+            return true;
+        }
+        return traits_type::compare(left, right, count) == 0;
+    }
+
+    constexpr void replace_range(const size_type position, const size_type count, const const_pointer src, const size_type src_len) {
+        BS_VERIFY(position <= size(), "the replace position exceeds the length of the string");
+        BS_VERIFY(count <= size() - position, "the replaced range exceeds the length of the string");
+        const size_type tail = size() - position - count;
+        if (src_len + tail > N - position) {
+            overflow();
+        }
+        // the source may refer to the string itself, the result is written into a copy
+        value_type result[N == 0 ? 1 : N]{};
+        traits_type::copy(result, chars, position);
+        const size_type src_count = src_len < N - position ? src_len : N - position;
+        traits_type::copy(result + position, src, src_count);
+        const size_type tail_count = tail < N - position - src_count ? tail : N - position - src_count;
+        traits_type::copy(result + position + src_count, chars + position + count, tail_count);
+        traits_type::copy(chars, result, N);
+        char_count = static_cast<detail::inline_size_t<N, Char>>(position + src_count + tail_count);
+    }
+};
+
+template<class Char, std::size_t M>
+inline_string(const Char (&)[M]) -> inline_string<M - 1, Char>;
+
+template<std::size_t N, class Char, class OverflowPolicy>
+struct hash<inline_string<N, Char, OverflowPolicy>> : hash<bs::string_viewt<char_traits<Char>>> {};
+
+}
+
+namespace std {
+    template<std::size_t N, class Char, class OverflowPolicy>
+    struct hash<bs::inline_string<N, Char, OverflowPolicy>> : bs::hash<bs::inline_string<N, Char, OverflowPolicy>> {};
+}
@@ -0,0 +1,282 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <betterstring/string_view.hpp>
+#include <betterstring/allocators.hpp>
+#include <betterstring/hash.hpp>
+#include <betterstring/detail/preprocessor.hpp>
+#include <betterstring/detail/bit.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace bs {
+
+// Handle of an interned string, equal strings of one pool have equal handles.
+class intern_handle {
+public:
+    constexpr intern_handle() noexcept = default;
+    explicit constexpr intern_handle(const std::uint32_t value_) noexcept
+        : handle_value(value_) {}
+
+    constexpr std::uint32_t value() const noexcept { return handle_value; }
+
+    friend constexpr bool operator==(const intern_handle left, const intern_handle right) noexcept { return left.handle_value == right.handle_value; }
+    friend constexpr bool operator!=(const intern_handle left, const intern_handle right) noexcept { return left.handle_value != right.handle_value; }
+    friend constexpr bool operator<(const intern_handle left, const intern_handle right) noexcept { return left.handle_value < right.handle_value; }
+
+private:
+    std::uint32_t handle_value = 0;
+};
+
+// Stores one copy of every distinct string and returns 32-bit handles and views which are stable for the lifetime of the pool.
+// The pool is split into shards by the hash of the string. Lookup does not take a lock,
+// insertion locks only the shard of the string, so threads interning different strings rarely wait for each other.
+template<class Traits>
+class intern_poolt {
+public:
+    using traits_type = Traits;
+    using value_type = typename Traits::char_type;
+    using size_type = typename Traits::size_type;
+    using string_view_type = bs::string_viewt<Traits>;
+
+    static constexpr std::uint32_t shard_count = 16;
+    // the largest number of strings in one shard
+    static constexpr std::uint32_t max_shard_size = std::uint32_t(1) << (32 - 4);
+
+    intern_poolt() = default;
+    intern_poolt(const intern_poolt&) = delete;
+    intern_poolt& operator=(const intern_poolt&) = delete;
+
+    // Returns the handle of the string, copies it into the pool if it is not there yet.
+    // Thread-safe, throws `std::length_error` if the shard of the string is full.
+    intern_handle intern(const string_view_type str) {
+        const std::uint64_t hash = bs::hash_string<Traits>(str);
+        shard& target = shards[shard_index(hash)];
+        if (const std::uint32_t found = target.find(hash, str); found != shard::not_found) {
+            return make_handle(hash, found);
+        }
+        return make_handle(hash, target.insert(hash, str));
+    }
+
+    // Returns the handle of the string if it was interned. Thread-safe and lock-free.
+    std::optional<intern_handle> find(const string_view_type str) const noexcept {
+        const std::uint64_t hash = bs::hash_string<Traits>(str);
+        const std::uint32_t found = shards[shard_index(hash)].find(hash, str);
+        if (found == shard::not_found) { return std::nullopt; }
+        return make_handle(hash, found);
+    }
+
+    // Returns the interned string, the view is valid for the lifetime of the pool. Thread-safe and lock-free.
+    // **Undefined behavior** if the handle was not returned by this pool.
+    string_view_type view(const intern_handle handle) const noexcept BS_LIFETIMEBOUND {
+        const entry& interned = shards[handle.value() % shard_count].entry_at(handle.value() / shard_count);
+        return string_view_type(interned.data, interned.size);
+    }
+    string_view_type operator[](const intern_handle handle) const noexcept BS_LIFETIMEBOUND {
+        return view(handle);
+    }
+
+    // Interns the string and returns its stable view.
+    string_view_type intern_view(const string_view_type str) BS_LIFETIMEBOUND {
+        return view(intern(str));
+    }
+
+    // the number of distinct strings
+    size_type size() const noexcept {
+        size_type count = 0;
+        for (const shard& s : shards) {
+            count += s.count.load(std::memory_order_relaxed);
+        }
+        return count;
+    }
+
+    // the bytes allocated by the pool for the characters, the entries and the hash tables
+    std::size_t bytes_reserved() const {
+        std::size_t bytes = sizeof(*this);
+        for (const shard& s : shards) {
+            bytes += s.bytes_reserved();
+        }
+        return bytes;
+    }
+
+private:
+    struct entry {
+        const value_type* data;
+        size_type size;
+        std::uint64_t hash;
+    };
+
+    // Open addressing table with linear probing. A slot holds the high half of the hash
+    // and the index of the entry plus one, zero is an empty slot.
+    struct table {
+        explicit table(const std::size_t capacity)
+            : mask(capacity - 1), slots(new std::atomic<std::uint64_t>[capacity]()) {}
+
+        std::size_t capacity() const noexcept { return mask + 1; }
+
+        std::size_t mask;
+        std::unique_ptr<std::atomic<std::uint64_t>[]> slots;
+    };
+
+    class shard {
+    public:
+        static constexpr std::uint32_t not_found = ~std::uint32_t(0);
+
+        shard() = default;
+        ~shard() {
+            for (std::atomic<entry*>& segment : segments) {
+                delete[] segment.load(std::memory_order_relaxed);
+            }
+        }
+
+        // lock-free, the entries and the slots are published by the release stores of insert
+        std::uint32_t find(const std::uint64_t hash, const string_view_type str) const noexcept {
+            const table* const current = current_table.load(std::memory_order_acquire);
+            if (current == nullptr) { return not_found; }
+            const std::uint64_t fingerprint = hash >> 32;
+            for (std::size_t position = hash & current->mask; ; position = (position + 1) & current->mask) {
+                const std::uint64_t slot = current->slots[position].load(std::memory_order_acquire);
+                if (slot == 0) { return not_found; }
+                if (slot >> 32 == fingerprint) {
+                    const std::uint32_t index = static_cast<std::uint32_t>(slot) - 1;
+                    const entry& candidate = entry_at(index);
+                    if (string_view_type(candidate.data, candidate.size) == str) {
+                        return index;
+                    }
+                }
+            }
+        }
+
+        std::uint32_t insert(const std::uint64_t hash, const string_view_type str) {
+            const std::lock_guard<std::mutex> lock(insert_mutex);
+            // another thread may have inserted the string after the lock-free lookup
+            if (const std::uint32_t found = find(hash, str); found != not_found) {
+                return found;
+            }
+            const std::uint32_t index = count.load(std::memory_order_relaxed);
+            if (index == max_shard_size) {
+                throw std::length_error("too many strings in the intern pool");
+            }
+            table* current = current_table.load(std::memory_order_relaxed);
+            if (current == nullptr || (std::size_t(index) + 1) * 2 > current->capacity()) {
+                current = grow(current);
+            }
+
+            value_type* const chars = static_cast<value_type*>(arena.allocate(str.size() * sizeof(value_type), alignof(value_type)));
+            Traits::copy(chars, str.data(), str.size());
+            entry& new_entry = allocate_entry(index);
+            new_entry = entry{chars, str.size(), hash};
+
+            std::size_t position = hash & current->mask;
+            while (current->slots[position].load(std::memory_order_relaxed) != 0) {
+                position = (position + 1) & current->mask;
+            }
+            current->slots[position].store(((hash >> 32) << 32) | (std::uint64_t(index) + 1), std::memory_order_release);
+            count.store(index + 1, std::memory_order_relaxed);
+            return index;
+        }
+
+        const entry& entry_at(const std::uint32_t index) const noexcept {
+            const std::size_t segment = segment_of(index);
+            return segments[segment].load(std::memory_order_acquire)[index - segment_first(segment)];
+        }
+
+        std::size_t bytes_reserved() const {
+            const std::lock_guard<std::mutex> lock(insert_mutex);
+            std::size_t bytes = arena.bytes_reserved();
+            for (std::size_t segment = 0; segment < segment_count; ++segment) {
+                if (segments[segment].load(std::memory_order_relaxed) != nullptr) {
+                    bytes += segment_size(segment) * sizeof(entry);
+                }
+            }
+            for (const auto& retired : tables) {
+                bytes += retired->capacity() * sizeof(std::uint64_t);
+            }
+            return bytes;
+        }
+
+        std::atomic<std::uint32_t> count{0};
+
+    private:
+        // the entries are in segments of doubling size, so they never move
+        static constexpr std::size_t first_segment_size = 64;
+        static constexpr std::size_t segment_count = 23;
+
+        static std::size_t segment_of(const std::uint32_t index) noexcept {
+            return static_cast<std::size_t>(detail::bit_width(index / first_segment_size + 1)) - 1;
+        }
+        static std::size_t segment_first(const std::size_t segment) noexcept {
+            return first_segment_size * ((std::size_t(1) << segment) - 1);
+        }
+        static std::size_t segment_size(const std::size_t segment) noexcept {
+            return first_segment_size << segment;
+        }
+
+        entry& allocate_entry(const std::uint32_t index) {
+            const std::size_t segment = segment_of(index);
+            entry* entries = segments[segment].load(std::memory_order_relaxed);
+            if (entries == nullptr) {
+                entries = new entry[segment_size(segment)];
+                segments[segment].store(entries, std::memory_order_release);
+            }
+            return entries[index - segment_first(segment)];
+        }
+
+        // The old tables are kept until the pool is destroyed, the lock-free readers may still probe them.
+        // Their total size is less than the size of the current table.
+        BS_NOINLINE table* grow(const table* const current) {
+            auto next = std::make_unique<table>(current == nullptr ? 64 : current->capacity() * 2);
+            const std::uint32_t size = count.load(std::memory_order_relaxed);
+            for (std::uint32_t index = 0; index < size; ++index) {
+                const std::uint64_t hash = entry_at(index).hash;
+                std::size_t position = hash & next->mask;
+                while (next->slots[position].load(std::memory_order_relaxed) != 0) {
+                    position = (position + 1) & next->mask;
+                }
+                next->slots[position].store(((hash >> 32) << 32) | (std::uint64_t(index) + 1), std::memory_order_relaxed);
+            }
+            table* const published = next.get();
+            tables.push_back(std::move(next));
+            current_table.store(published, std::memory_order_release);
+            return published;
+        }
+
+        std::atomic<table*> current_table{nullptr};
+        std::atomic<entry*> segments[segment_count]{};
+        std::vector<std::unique_ptr<table>> tables;
+        monotonic_arena arena;
+        mutable std::mutex insert_mutex;
+    };
+
+    static std::uint32_t shard_index(const std::uint64_t hash) noexcept {
+        return static_cast<std::uint32_t>(hash >> 60) % shard_count;
+    }
+    static intern_handle make_handle(const std::uint64_t hash, const std::uint32_t index) noexcept {
+        return intern_handle(index * shard_count + shard_index(hash));
+    }
+
+    shard shards[shard_count];
+};
+
+using intern_pool = intern_poolt<char_traits<char>>;
+
+}
+
+namespace std {
+    template<>
+    struct hash<bs::intern_handle> {
+        std::size_t operator()(const bs::intern_handle handle) const noexcept {
+            return std::hash<std::uint32_t>{}(handle.value());
+        }
+    };
+}
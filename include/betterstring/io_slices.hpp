@@ -0,0 +1,179 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <betterstring/string.hpp>
+#include <betterstring/string_view.hpp>
+#include <betterstring/string_builder.hpp>
+#include <betterstring/detail/preprocessor.hpp>
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+#if BS_OS_WINDOWS
+    #include <io.h>
+    #include <stdio.h>
+#else
+    #include <sys/types.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+#endif
+
+namespace bs {
+
+// Collects the string fragments into an array of `struct iovec`, the characters are not copied.
+// `writev` and `pwritev` write all fragments with as few system calls as possible:
+// the array is passed in batches of at most `max_batch_slices` and a partial write continues with the rest.
+// The fragments must stay alive until they are written.
+class io_slices {
+public:
+#if BS_OS_WINDOWS
+    // the same layout as `struct iovec`, Windows writes the slices one by one
+    struct slice_type {
+        void* iov_base;
+        std::size_t iov_len;
+    };
+#else
+    using slice_type = ::iovec;
+#endif
+
+#ifdef IOV_MAX
+    static constexpr std::size_t max_batch_slices = IOV_MAX;
+#else
+    static constexpr std::size_t max_batch_slices = 1024;
+#endif
+
+    io_slices() noexcept = default;
+    explicit io_slices(const std::size_t slice_capacity) {
+        slices.reserve(slice_capacity);
+    }
+
+    // The empty fragments are skipped.
+    template<class Traits>
+    void push_back(const bs::string_viewt<Traits> str) {
+        if (str.empty()) { return; }
+        slices.push_back(slice_type{const_cast<typename Traits::char_type*>(str.data()), str.size() * sizeof(typename Traits::char_type)});
+        pending_bytes += str.size() * sizeof(typename Traits::char_type);
+    }
+    template<class Traits>
+    void push_back(const bs::stringt<Traits>& str) {
+        push_back(bs::string_viewt<Traits>(str));
+    }
+    // adds every segment of the builder
+    template<class Traits>
+    void push_back(const bs::string_buildert<Traits>& builder) {
+        for (const bs::string_viewt<Traits> segment : builder.segments()) {
+            push_back(segment);
+        }
+    }
+    template<class... Fragments>
+    void push_back_all(const Fragments&... fragments) {
+        (push_back(fragments), ...);
+    }
+
+    // the slices which are not written yet, a partially written slice starts after the written characters
+    const slice_type* data() const noexcept { return slices.data() + first; }
+    std::size_t size() const noexcept { return slices.size() - first; }
+    [[nodiscard]] bool empty() const noexcept { return first == slices.size(); }
+    // the number of bytes which are not written yet
+    std::size_t bytes() const noexcept { return pending_bytes; }
+
+    void clear() noexcept {
+        slices.clear();
+        first = 0;
+        pending_bytes = 0;
+    }
+
+    // Writes all slices to `fd`, returns the number of written bytes. The written slices are removed.
+    // Throws `std::system_error` if writing fails, the slices which are not written are kept
+    // and a non-blocking descriptor may be written again after it becomes writable.
+    std::size_t writev(const int fd) {
+        const std::size_t total = pending_bytes;
+        while (!empty()) {
+            consume(write_batch(fd));
+        }
+        clear();
+        return total;
+    }
+    // Writes all slices to `fd` at `offset` without changing the file position, returns the number of written bytes.
+    std::size_t pwritev(const int fd, const std::int64_t offset) {
+        const std::size_t total = pending_bytes;
+        std::int64_t position = offset;
+        while (!empty()) {
+            const std::size_t written = write_batch_at(fd, position);
+            position += static_cast<std::int64_t>(written);
+            consume(written);
+        }
+        clear();
+        return total;
+    }
+
+private:
+    std::size_t batch_size() const noexcept {
+        return size() < max_batch_slices ? size() : max_batch_slices;
+    }
+
+    // removes the written bytes from the front of the slices
+    void consume(std::size_t written) noexcept {
+        pending_bytes -= written;
+        while (written != 0) {
+            slice_type& slice = slices[first];
+            if (written < slice.iov_len) {
+                slice.iov_base = static_cast<char*>(slice.iov_base) + written;
+                slice.iov_len -= written;
+                return;
+            }
+            written -= slice.iov_len;
+            ++first;
+        }
+    }
+
+#if BS_OS_WINDOWS
+    std::size_t write_batch(const int fd) {
+        const slice_type& slice = slices[first];
+        const unsigned int max_write = 1u << 30;
+        const int result = ::_write(fd, slice.iov_base, static_cast<unsigned int>(slice.iov_len < max_write ? slice.iov_len : max_write));
+        if (result < 0) {
+            throw std::system_error(errno, std::generic_category(), "failed to write the file");
+        }
+        return static_cast<std::size_t>(result);
+    }
+    std::size_t write_batch_at(const int fd, const std::int64_t position) {
+        if (::_lseeki64(fd, position, SEEK_SET) < 0) {
+            throw std::system_error(errno, std::generic_category(), "failed to seek the file");
+        }
+        return write_batch(fd);
+    }
+#else
+    std::size_t write_batch(const int fd) {
+        while (true) {
+            const auto result = ::writev(fd, data(), static_cast<int>(batch_size()));
+            if (result >= 0) { return static_cast<std::size_t>(result); }
+            if (errno != EINTR) {
+                throw std::system_error(errno, std::generic_category(), "failed to write the file");
+            }
+        }
+    }
+    std::size_t write_batch_at(const int fd, const std::int64_t position) {
+        while (true) {
+            const auto result = ::pwritev(fd, data(), static_cast<int>(batch_size()), static_cast<off_t>(position));
+            if (result >= 0) { return static_cast<std::size_t>(result); }
+            if (errno != EINTR) {
+                throw std::system_error(errno, std::generic_category(), "failed to write the file");
+            }
+        }
+    }
+#endif
+
+    std::vector<slice_type> slices;
+    // the index of the first slice which is not written
+    std::size_t first = 0;
+    std::size_t pending_bytes = 0;
+};
+
+}
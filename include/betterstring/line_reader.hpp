@@ -0,0 +1,168 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <betterstring/string_view.hpp>
+#include <betterstring/allocators.hpp>
+#include <betterstring/detail/preprocessor.hpp>
+#include <cerrno>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <system_error>
+#include <vector>
+
+#if BS_OS_WINDOWS
+    #include <io.h>
+#else
+    #include <unistd.h>
+#endif
+
+namespace bs {
+
+class line_reader;
+
+namespace detail {
+    class line_reader_iterator {
+    public:
+        // iterator traits
+        using difference_type = std::ptrdiff_t;
+        using value_type = bs::string_view;
+        using reference = bs::string_view;
+        using pointer = void;
+        using iterator_category = std::input_iterator_tag;
+
+        struct end_tag {};
+
+        explicit line_reader_iterator(line_reader& reader_);
+        // the end iterator, does not read the line
+        line_reader_iterator(line_reader& reader_, end_tag) noexcept
+            : reader(&reader_) {}
+
+        bs::string_view operator*() const noexcept { return *line; }
+
+        line_reader_iterator& operator++();
+        line_reader_iterator operator++(int) {
+            auto tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator!=(const line_reader_iterator&) const noexcept { return line.has_value(); }
+        bool operator==(const line_reader_iterator&) const noexcept { return !line.has_value(); }
+
+    private:
+        line_reader* reader;
+        std::optional<bs::string_view> line;
+    };
+}
+
+// Reads the lines of a file descriptor into a reusable buffer, the lines are returned as views into the buffer.
+// Only the beginning of the line at the end of the buffer is copied when the buffer is refilled.
+// The lines are the same as produced by `lines()` for the whole content: without "\n" or "\r\n" and without the empty line after the last newline.
+class line_reader {
+public:
+    using buffer_type = std::vector<char, aligned_allocator<char, 64>>;
+    using iterator = detail::line_reader_iterator;
+
+    static constexpr std::size_t default_buffer_size = std::size_t(1) << 20;
+
+    // Reads from `fd`, which is not closed by the reader.
+    explicit line_reader(const int fd_, const std::size_t buffer_size = default_buffer_size)
+        : fd(fd_), buffer(buffer_size) {
+        BS_VERIFY(buffer_size != 0, "buffer size is zero");
+    }
+
+    // Returns the next line or an empty optional at the end of the file, the line is valid until the next call.
+    // Throws `std::system_error` if reading fails.
+    std::optional<bs::string_view> next_line() {
+        while (true) {
+            const char* const first = buffer.data() + line_begin;
+            const char* const newline = bs::char_traits<char>::find(buffer.data() + search_begin, data_end - search_begin, '\n');
+            if (newline != nullptr) {
+                const std::size_t line_end = static_cast<std::size_t>(newline - buffer.data());
+                line_begin = line_end + 1;
+                search_begin = line_begin;
+                return strip_carriage_return(bs::string_view(first, static_cast<std::size_t>(newline - first)));
+            }
+            if (end_of_file) {
+                if (line_begin == data_end) { return std::nullopt; }
+                const bs::string_view last_line(first, data_end - line_begin);
+                line_begin = data_end;
+                search_begin = data_end;
+                return strip_carriage_return(last_line);
+            }
+            search_begin = data_end;
+            refill();
+        }
+    }
+
+    iterator begin() { return iterator{*this}; }
+    iterator end() noexcept { return iterator{*this, iterator::end_tag{}}; }
+
+    std::size_t buffer_size() const noexcept { return buffer.size(); }
+
+private:
+    static bs::string_view strip_carriage_return(bs::string_view line) noexcept {
+        if (line.ends_with('\r')) {
+            line.remove_suffix(1);
+        }
+        return line;
+    }
+
+    // moves the unfinished line to the beginning of the buffer and reads after it
+    void refill() {
+        const std::size_t pending = data_end - line_begin;
+        if (line_begin != 0) {
+            bs::char_traits<char>::move(buffer.data(), buffer.data() + line_begin, pending);
+            search_begin -= line_begin;
+            line_begin = 0;
+            data_end = pending;
+        }
+        if (data_end == buffer.size()) {
+            // the line does not fit into the buffer
+            buffer.resize(buffer.size() * 2);
+        }
+        const std::size_t read_count = read_some(buffer.data() + data_end, buffer.size() - data_end);
+        if (read_count == 0) {
+            end_of_file = true;
+        }
+        data_end += read_count;
+    }
+
+    std::size_t read_some(char* const dest, const std::size_t count) {
+        while (true) {
+#if BS_OS_WINDOWS
+            const unsigned int max_read = 1u << 30;
+            const int result = ::_read(fd, dest, static_cast<unsigned int>(count < max_read ? count : max_read));
+#else
+            const auto result = ::read(fd, dest, count);
+#endif
+            if (result >= 0) { return static_cast<std::size_t>(result); }
+            if (errno != EINTR) {
+                throw std::system_error(errno, std::generic_category(), "failed to read the file");
+            }
+        }
+    }
+
+    int fd;
+    buffer_type buffer;
+    std::size_t line_begin = 0;
+    std::size_t search_begin = 0;
+    std::size_t data_end = 0;
+    bool end_of_file = false;
+};
+
+namespace detail {
+    inline line_reader_iterator::line_reader_iterator(line_reader& reader_)
+        : reader(&reader_), line(reader_.next_line()) {}
+
+    inline line_reader_iterator& line_reader_iterator::operator++() {
+        line = reader->next_line();
+        return *this;
+    }
+}
+
+}
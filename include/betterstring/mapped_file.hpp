@@ -0,0 +1,225 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <betterstring/string_view.hpp>
+#include <betterstring/type_traits.hpp>
+#include <betterstring/detail/preprocessor.hpp>
+#include <cerrno>
+#include <cstddef>
+#include <system_error>
+#include <utility>
+
+#if BS_OS_WINDOWS
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#if BS_COMP_MSVC
+    #include <xmmintrin.h>
+#endif
+
+namespace bs {
+
+namespace detail {
+    BS_FORCEINLINE
+    inline void prefetch_read(const void* const address) noexcept {
+#if BS_COMP_MSVC
+        _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+        __builtin_prefetch(address, 0, 3);
+#endif
+    }
+}
+
+// Read-only view of the whole file mapped into memory.
+// The characters are read from the page cache when they are accessed, there is no copy of the file.
+class mapped_file {
+public:
+    enum class access_hint {
+        normal,
+        // the pages are read in order, the kernel reads ahead more aggressively
+        sequential,
+        // the pages are accessed in random order, read-ahead is disabled
+        random,
+        // the pages are read in the background before they are accessed
+        will_need,
+        // back the mapping with transparent huge pages, fewer TLB misses
+        huge_pages,
+    };
+
+    constexpr mapped_file() noexcept = default;
+
+    // Maps the file, throws `std::system_error` if it can not be opened or mapped.
+    explicit mapped_file(const char* const path) {
+#if BS_OS_WINDOWS
+        const HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::system_error(static_cast<int>(GetLastError()), std::system_category(), "failed to open the file");
+        }
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file, &file_size)) {
+            const DWORD error = GetLastError();
+            CloseHandle(file);
+            throw std::system_error(static_cast<int>(error), std::system_category(), "failed to get the size of the file");
+        }
+        mapping_size = static_cast<std::size_t>(file_size.QuadPart);
+        if (mapping_size != 0) {
+            const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            const DWORD mapping_error = GetLastError();
+            CloseHandle(file);
+            if (mapping == nullptr) {
+                throw std::system_error(static_cast<int>(mapping_error), std::system_category(), "failed to map the file");
+            }
+            void* const address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            const DWORD view_error = GetLastError();
+            CloseHandle(mapping);
+            if (address == nullptr) {
+                throw std::system_error(static_cast<int>(view_error), std::system_category(), "failed to map the file");
+            }
+            mapping_data = static_cast<const char*>(address);
+        } else {
+            CloseHandle(file);
+        }
+#else
+        const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+        if (fd == -1) {
+            throw std::system_error(errno, std::generic_category(), "failed to open the file");
+        }
+        struct stat file_stat;
+        if (::fstat(fd, &file_stat) == -1) {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "failed to get the size of the file");
+        }
+        mapping_size = static_cast<std::size_t>(file_stat.st_size);
+        // an empty file can not be mapped, the view is empty
+        if (mapping_size != 0) {
+            void* const address = ::mmap(nullptr, mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            const int error = errno;
+            ::close(fd);
+            if (address == MAP_FAILED) {
+                mapping_size = 0;
+                throw std::system_error(error, std::generic_category(), "failed to map the file");
+            }
+            mapping_data = static_cast<const char*>(address);
+        } else {
+            ::close(fd);
+        }
+#endif
+    }
+
+    mapped_file(mapped_file&& other) noexcept
+        : mapping_data(std::exchange(other.mapping_data, nullptr)), mapping_size(std::exchange(other.mapping_size, 0)) {}
+    mapped_file& operator=(mapped_file&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            mapping_data = std::exchange(other.mapping_data, nullptr);
+            mapping_size = std::exchange(other.mapping_size, 0);
+        }
+        return *this;
+    }
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    ~mapped_file() { unmap(); }
+
+    const char* data() const noexcept BS_LIFETIMEBOUND { return mapping_data; }
+    std::size_t size() const noexcept { return mapping_size; }
+    [[nodiscard]] bool empty() const noexcept { return mapping_size == 0; }
+
+    bs::string_view view() const noexcept BS_LIFETIMEBOUND {
+        return mapping_data == nullptr ? bs::string_view{} : bs::string_view{mapping_data, mapping_size};
+    }
+    operator bs::string_view() const noexcept BS_LIFETIMEBOUND { return view(); }
+
+    // Tells the OS how the file is going to be accessed, returns false if the hint is not supported.
+    bool advise(const access_hint hint) const noexcept {
+        if (mapping_data == nullptr) { return false; }
+#if BS_OS_WINDOWS
+        if (hint == access_hint::sequential || hint == access_hint::will_need) {
+            WIN32_MEMORY_RANGE_ENTRY range{const_cast<char*>(mapping_data), mapping_size};
+            return PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0) != 0;
+        }
+        return hint == access_hint::normal;
+#else
+        int advice = MADV_NORMAL;
+        switch (hint) {
+        case access_hint::normal: advice = MADV_NORMAL; break;
+        case access_hint::sequential: advice = MADV_SEQUENTIAL; break;
+        case access_hint::random: advice = MADV_RANDOM; break;
+        case access_hint::will_need: advice = MADV_WILLNEED; break;
+        case access_hint::huge_pages:
+    #ifdef MADV_HUGEPAGE
+            advice = MADV_HUGEPAGE;
+            break;
+    #else
+            return false;
+    #endif
+        }
+        return ::madvise(const_cast<char*>(mapping_data), mapping_size, advice) == 0;
+#endif
+    }
+
+    // Unmaps the file, the view becomes empty.
+    void close() noexcept {
+        unmap();
+        mapping_data = nullptr;
+        mapping_size = 0;
+    }
+
+private:
+    void unmap() noexcept {
+        if (mapping_data == nullptr) { return; }
+#if BS_OS_WINDOWS
+        UnmapViewOfFile(mapping_data);
+#else
+        ::munmap(const_cast<char*>(mapping_data), mapping_size);
+#endif
+    }
+
+    const char* mapping_data = nullptr;
+    std::size_t mapping_size = 0;
+};
+
+// the size of the pieces passed to `for_each_page`
+inline constexpr std::size_t scan_page_size = 4096;
+
+// Calls `f(page)` for every consecutive piece of `str` of `scan_page_size` characters (the last one may be shorter).
+// The cache lines of the page `prefetch_distance` pages ahead are prefetched before `f` is called,
+// so the memory is loaded while the current page is processed.
+template<class Traits = char_traits<char>, class F>
+void for_each_page(const detail::type_identity_t<bs::string_viewt<Traits>> str, F&& f, const std::size_t prefetch_distance = 4) {
+    using size_type = typename Traits::size_type;
+    constexpr std::size_t cache_line_size = 64;
+    constexpr size_type page_chars = static_cast<size_type>(scan_page_size / sizeof(typename Traits::char_type));
+    const auto* const bytes = reinterpret_cast<const char*>(str.data());
+    const std::size_t size_bytes = str.size() * sizeof(typename Traits::char_type);
+    const std::size_t prefetch_offset = prefetch_distance * scan_page_size;
+
+    for (size_type position = 0; position < str.size(); position += page_chars) {
+        const std::size_t first = static_cast<std::size_t>(position) * sizeof(typename Traits::char_type) + prefetch_offset;
+        if (prefetch_distance != 0 && first < size_bytes) {
+            const std::size_t last = first + scan_page_size < size_bytes ? first + scan_page_size : size_bytes;
+            for (std::size_t line = first; line < last; line += cache_line_size) {
+                detail::prefetch_read(bytes + line);
+            }
+        }
+        const size_type rest = str.size() - position;
+        f(str.substr(position, rest < page_chars ? rest : page_chars));
+    }
+}
+
+}
@@ -0,0 +1,454 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <betterstring/string_view.hpp>
+#include <betterstring/split_index.hpp>
+#include <betterstring/find_result.hpp>
+#include <betterstring/type_traits.hpp>
+#include <betterstring/detail/preprocessor.hpp>
+#include <betterstring/detail/integer_cmps.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace bs::par {
+
+// 256 KiB, chunks of this size fit into the L2 cache of one core
+inline constexpr std::size_t default_chunk_size = std::size_t(256) * 1024;
+
+// Fixed set of threads which execute the tasks of one bulk operation.
+// The calling thread takes part in the execution, the tasks are handed out one by one from a shared counter,
+// so a thread which finishes early takes the remaining tasks of the slower ones.
+class thread_pool {
+public:
+    // `threads` is the number of threads executing the tasks, including the calling thread
+    explicit thread_pool(const std::size_t threads = default_concurrency()) {
+        const std::size_t workers_count = threads == 0 ? 0 : threads - 1;
+        workers.reserve(workers_count);
+        try {
+            for (std::size_t i = 0; i < workers_count; ++i) {
+                workers.emplace_back([this]() { worker_loop(); });
+            }
+        } catch (...) {
+            // the destructor does not run, the started threads must be joined before the vector destroys them
+            stop();
+            throw;
+        }
+    }
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    ~thread_pool() {
+        stop();
+    }
+
+    static std::size_t default_concurrency() noexcept {
+        const unsigned int hardware = std::thread::hardware_concurrency();
+        return hardware == 0 ? 1 : static_cast<std::size_t>(hardware);
+    }
+
+    std::size_t concurrency() const noexcept { return workers.size() + 1; }
+
+    // Calls `f(i)` for every `i` in [0, count) and waits until all of the calls return.
+    // The first exception thrown by `f` is rethrown, the tasks which are not started yet are skipped.
+    // Must not be called from inside of a task of the same pool.
+    template<class F>
+    void bulk_execute(const std::size_t count, F&& f) {
+        if (count == 0) { return; }
+        using function_type = std::remove_reference_t<F>;
+        const std::lock_guard submit_lock{submit_mutex};
+        {
+            const std::lock_guard lock{mutex};
+            job.function = [](void* const context, const std::size_t index) {
+                (*static_cast<function_type*>(context))(index);
+            };
+            job.context = const_cast<void*>(static_cast<const void*>(std::addressof(f)));
+            job.count = count;
+            job.open = true;
+            next_index.store(0, std::memory_order_relaxed);
+            error = nullptr;
+            ++generation;
+        }
+        wake.notify_all();
+
+        run_tasks(job.function, job.context, count);
+
+        std::unique_lock lock{mutex};
+        // workers join the job only while it is open, so none of them touches `f` after this wait
+        job.open = false;
+        done.wait(lock, [this]() { return active == 0; });
+        if (error != nullptr) {
+            std::rethrow_exception(std::exchange(error, nullptr));
+        }
+    }
+
+private:
+    using task_function = void(*)(void*, std::size_t);
+
+    void stop() noexcept {
+        {
+            const std::lock_guard lock{mutex};
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+    }
+
+    void run_tasks(const task_function function, void* const context, const std::size_t count) noexcept {
+        while (true) {
+            const std::size_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+            if (index >= count) { return; }
+            try {
+                function(context, index);
+            } catch (...) {
+                const std::lock_guard lock{mutex};
+                if (error == nullptr) {
+                    error = std::current_exception();
+                }
+                next_index.store(count, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void worker_loop() noexcept {
+        std::size_t seen_generation = 0;
+        while (true) {
+            task_function function = nullptr;
+            void* context = nullptr;
+            std::size_t count = 0;
+            {
+                std::unique_lock lock{mutex};
+                wake.wait(lock, [&]() { return stopping || generation != seen_generation; });
+                if (stopping) { return; }
+                seen_generation = generation;
+                if (!job.open) { continue; }
+                function = job.function;
+                context = job.context;
+                count = job.count;
+                ++active;
+            }
+            run_tasks(function, context, count);
+            {
+                const std::lock_guard lock{mutex};
+                --active;
+            }
+            done.notify_all();
+        }
+    }
+
+    struct job_state {
+        task_function function = nullptr;
+        void* context = nullptr;
+        std::size_t count = 0;
+        bool open = false;
+    };
+
+    std::mutex submit_mutex;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    job_state job;
+    std::atomic<std::size_t> next_index{0};
+    std::size_t generation = 0;
+    std::size_t active = 0;
+    bool stopping = false;
+    std::exception_ptr error;
+    std::vector<std::thread> workers;
+};
+
+// Executes the tasks one after another on the calling thread.
+struct inline_executor {
+    std::size_t concurrency() const noexcept { return 1; }
+
+    template<class F>
+    void bulk_execute(const std::size_t count, F&& f) const {
+        for (std::size_t i = 0; i < count; ++i) {
+            f(i);
+        }
+    }
+};
+
+// The pool used by the functions which do not take an executor, it has one thread per hardware thread.
+inline thread_pool& default_pool() {
+    static thread_pool pool;
+    return pool;
+}
+
+namespace detail {
+    template<class Traits>
+    struct chunked_string {
+        using char_type = typename Traits::char_type;
+        using size_type = typename Traits::size_type;
+
+        chunked_string(const bs::string_viewt<Traits> str_, const std::size_t chunk_size_) noexcept
+            : str(str_), chunk_size(chunk_size_) {
+            BS_VERIFY(chunk_size != 0, "chunk size is zero");
+        }
+
+        std::size_t count() const noexcept {
+            return (static_cast<std::size_t>(str.size()) + chunk_size - 1) / chunk_size;
+        }
+        size_type first(const std::size_t chunk) const noexcept {
+            return static_cast<size_type>(chunk * chunk_size);
+        }
+        size_type last(const std::size_t chunk) const noexcept {
+            const std::size_t end = (chunk + 1) * chunk_size;
+            return end < static_cast<std::size_t>(str.size()) ? static_cast<size_type>(end) : str.size();
+        }
+        // the characters searched for the matches starting inside of the chunk
+        bs::string_viewt<Traits> window(const std::size_t chunk, const size_type needle_len) const noexcept {
+            const size_type begin = first(chunk);
+            const size_type end = last(chunk);
+            const size_type overlap = needle_len - 1;
+            const size_type window_end = str.size() - end > overlap ? end + overlap : str.size();
+            return str.substr(begin, window_end - begin);
+        }
+
+        bs::string_viewt<Traits> str;
+        std::size_t chunk_size;
+    };
+
+    template<class Traits>
+    typename Traits::size_type needle_size(const typename Traits::char_type) noexcept { return 1; }
+    template<class Traits>
+    typename Traits::size_type needle_size(const bs::string_viewt<Traits> needle) noexcept { return needle.size(); }
+
+    template<class Traits>
+    const typename Traits::char_type* find_needle(const typename Traits::char_type* const first, const std::size_t count,
+        const typename Traits::char_type needle) noexcept {
+        return Traits::find(first, count, needle);
+    }
+    template<class Traits>
+    const typename Traits::char_type* find_needle(const typename Traits::char_type* const first, const std::size_t count,
+        const bs::string_viewt<Traits> needle) noexcept {
+        return Traits::findstr(first, count, needle.data(), needle.size());
+    }
+
+    template<class Executor, class Traits, class Needle>
+    bs::find_result<const typename Traits::char_type, typename Traits::size_type> find_first(Executor&& executor,
+        const bs::string_viewt<Traits> str, const Needle needle, const std::size_t chunk_size) {
+        using size_type = typename Traits::size_type;
+        const chunked_string<Traits> chunks{str, chunk_size};
+        const size_type needle_len = detail::needle_size<Traits>(needle);
+        BS_VERIFY(needle_len != 0, "searched string is empty");
+
+        // the chunks after the best match so far are skipped, the smallest position wins regardless of the order of the tasks
+        std::atomic<size_type> best{str.size()};
+        executor.bulk_execute(chunks.count(), [&](const std::size_t chunk) {
+            if (chunks.first(chunk) >= best.load(std::memory_order_relaxed)) { return; }
+            const auto window = chunks.window(chunk, needle_len);
+            const auto* const found = detail::find_needle<Traits>(window.data(), window.size(), needle);
+            if (found == nullptr) { return; }
+            const size_type position = static_cast<size_type>(found - str.data());
+            size_type current = best.load(std::memory_order_relaxed);
+            while (position < current && !best.compare_exchange_weak(current, position, std::memory_order_relaxed)) {}
+        });
+
+        const size_type position = best.load(std::memory_order_relaxed);
+        return { str.data(), str.size(), position == str.size() ? nullptr : str.data() + position };
+    }
+
+    // Positions of all non-overlapping matches, the same as the ones found by `str.find_all(needle)`.
+    template<class Offset, class Executor, class Traits, class Needle>
+    std::vector<Offset> find_all(Executor&& executor, const bs::string_viewt<Traits> str, const Needle needle, const std::size_t chunk_size) {
+        static_assert(std::is_integral_v<Offset> && std::is_unsigned_v<Offset>, "offsets must be unsigned integers");
+        using size_type = typename Traits::size_type;
+        const chunked_string<Traits> chunks{str, chunk_size};
+        const size_type needle_len = detail::needle_size<Traits>(needle);
+        BS_VERIFY(needle_len != 0, "searched string is empty");
+        BS_VERIFY(str.size() == 0 || bs::detail::cmp_less_equal(str.size() - 1, (std::numeric_limits<Offset>::max)()), "the positions do not fit into the integer type");
+
+        // 1. the matches of every chunk, relative to the beginning of the chunk
+        struct chunk_matches {
+            std::vector<Offset> positions;
+            // global positions of the matches found when the chain of matches is resynchronized
+            std::vector<Offset> resynced;
+            std::size_t first_kept = 0;
+            std::size_t output = 0;
+        };
+        std::vector<chunk_matches> matches(chunks.count());
+        executor.bulk_execute(matches.size(), [&](const std::size_t chunk) {
+            std::vector<Offset>& positions = matches[chunk].positions;
+            auto it = chunks.window(chunk, needle_len).find_all(needle).begin();
+            while (true) {
+                const std::size_t old_size = positions.size();
+                const std::size_t grow_size = old_size < 64 ? 64 : old_size;
+                positions.resize(old_size + grow_size);
+                const std::size_t written = it.positions_into(positions.data() + old_size, grow_size);
+                positions.resize(old_size + written);
+                if (written < grow_size) { break; }
+            }
+        });
+
+        // 2. every chunk searches from its beginning, but the last match of the previous chunk may extend into it.
+        // In this case the matches are searched again from the end of that match until a match of the chunk is reached,
+        // the following matches of the chunk are the same.
+        std::size_t total = 0;
+        size_type resume = 0;
+        for (std::size_t chunk = 0; chunk < matches.size(); ++chunk) {
+            chunk_matches& current = matches[chunk];
+            const size_type base = chunks.first(chunk);
+            const size_type end = chunks.last(chunk);
+            const auto& positions = current.positions;
+            std::size_t kept = 0;
+            if (resume > base) {
+                const auto window = chunks.window(chunk, needle_len);
+                while (kept < positions.size()) {
+                    if (resume >= end) {
+                        kept = positions.size();
+                        break;
+                    }
+                    const size_type window_offset = resume - base;
+                    const auto* const found = detail::find_needle<Traits>(window.data() + window_offset, window.size() - window_offset, needle);
+                    if (found == nullptr) {
+                        kept = positions.size();
+                        break;
+                    }
+                    const size_type position = static_cast<size_type>(found - window.data());
+                    while (kept < positions.size() && positions[kept] < position) { ++kept; }
+                    if (kept < positions.size() && positions[kept] == position) { break; }
+                    current.resynced.push_back(static_cast<Offset>(base + position));
+                    resume = base + position + needle_len;
+                }
+            }
+            current.first_kept = kept;
+            current.output = total;
+            total += current.resynced.size() + (positions.size() - kept);
+            if (kept < positions.size()) {
+                resume = base + static_cast<size_type>(positions.back()) + needle_len;
+            } else if (!current.resynced.empty()) {
+                resume = static_cast<size_type>(current.resynced.back()) + needle_len;
+            }
+        }
+
+        // 3. the chunks are written at their offsets in the result
+        std::vector<Offset> result(total);
+        executor.bulk_execute(matches.size(), [&](const std::size_t chunk) {
+            const chunk_matches& current = matches[chunk];
+            const Offset base = static_cast<Offset>(chunks.first(chunk));
+            Offset* out = result.data() + current.output;
+            for (const Offset position : current.resynced) {
+                *out++ = position;
+            }
+            for (std::size_t i = current.first_kept; i < current.positions.size(); ++i) {
+                *out++ = static_cast<Offset>(base + current.positions[i]);
+            }
+        });
+        return result;
+    }
+}
+
+// Returns the number of characters equal to `ch`.
+template<class Executor, class Traits = char_traits<char>>
+std::size_t count(Executor&& executor, const bs::detail::type_identity_t<bs::string_viewt<Traits>> str, const typename Traits::char_type ch,
+    const std::size_t chunk_size = default_chunk_size) {
+    const detail::chunked_string<Traits> chunks{str, chunk_size};
+    std::vector<std::size_t> partial(chunks.count());
+    executor.bulk_execute(partial.size(), [&](const std::size_t chunk) {
+        partial[chunk] = Traits::count(str.data() + chunks.first(chunk), chunks.last(chunk) - chunks.first(chunk), ch);
+    });
+    std::size_t result = 0;
+    for (const std::size_t value : partial) {
+        result += value;
+    }
+    return result;
+}
+template<class Traits = char_traits<char>>
+std::size_t count(const bs::detail::type_identity_t<bs::string_viewt<Traits>> str, const typename Traits::char_type ch) {
+    return par::count<thread_pool&, Traits>(default_pool(), str, ch);
+}
+
+// Returns the first position of `ch`, the same as `str.find(ch)`.
+template<class Executor, class Traits = char_traits<char>>
+bs::find_result<const typename Traits::char_type, typename Traits::size_type> find_first(Executor&& executor,
+    const bs::detail::type_identity_t<bs::string_viewt<Traits>> str, const typename Traits::char_type ch, const std::size_t chunk_size = default_chunk_size) {
+    return detail::find_first(executor, str, ch, chunk_size);
+}
+// Returns the first position of `needle`, the same as `str.find(needle)`.
+template<class Executor, class Traits = char_traits<char>>
+bs::find_result<const typename Traits::char_type, typename Traits::size_type> find_first(Executor&& executor,
+    const bs::detail::type_identity_t<bs::string_viewt<Traits>> str, const bs::detail::type_identity_t<bs::string_viewt<Traits>> needle,
+    const std::size_t chunk_size = default_chunk_size) {
+    return detail::find_first(executor, str, needle, chunk_size);
+}
+template<class Traits = char_traits<char>>
+bs::find_result<const typename Traits::char_type, typename Traits::size_type> find_first(const bs::detail::type_identity_t<bs::string_viewt<Traits>> str,
+    const typename Traits::char_type ch) {
+    return par::find_first<thread_pool&, Traits>(default_pool(), str, ch);
+}
+template<class Traits = char_traits<char>>
+bs::find_result<const typename Traits::char_type, typename Traits::size_type> find_first(const bs::detail::type_identity_t<bs::string_viewt<Traits>> str,
+    const bs::detail::type_identity_t<bs::string_viewt<Traits>> needle) {
+    return par::find_first<thread_pool&, Traits>(default_pool(), str, needle);
+}
+
+// Returns the positions of every `ch`, the same as the ones produced by `str.find_all(ch)`.
+template<class Executor, class Traits = char_traits<char>>
+std::vector<typename Traits::size_type> find_all(Executor&& executor, const bs::detail::type_identity_t<bs::string_viewt<Traits>> str,
+    const typename Traits::char_type ch, const std::size_t chunk_size = default_chunk_size) {
+    return detail::find_all<typename Traits::size_type>(executor, str, ch, chunk_size);
+}
+// Returns the positions of every non-overlapping `needle`, the same as the ones produced by `str.find_all(needle)`.
+template<class Executor, class Traits = char_traits<char>>
+std::vector<typename Traits::size_type> find_all(Executor&& executor, const bs::detail::type_identity_t<bs::string_viewt<Traits>> str,
+    const bs::detail::type_identity_t<bs::string_viewt<Traits>> needle, const std::size_t chunk_size = default_chunk_size) {
+    return detail::find_all<typename Traits::size_type>(executor, str, needle, chunk_size);
+}
+template<class Traits = char_traits<char>>
+std::vector<typename Traits::size_type> find_all(const bs::detail::type_identity_t<bs::string_viewt<Traits>> str, const typename Traits::char_type ch) {
+    return par::find_all<thread_pool&, Traits>(default_pool(), str, ch);
+}
+template<class Traits = char_traits<char>>
+std::vector<typename Traits::size_type> find_all(const bs::detail::type_identity_t<bs::string_viewt<Traits>> str,
+    const bs::detail::type_identity_t<bs::string_viewt<Traits>> needle) {
+    return par::find_all<thread_pool&, Traits>(default_pool(), str, needle);
+}
+
+// The same fields as produced by `bs::split_index(str, separator)`, the separators are found in parallel.
+template<class Offset = std::uint32_t, class Executor, class Traits = char_traits<char>>
+split_fields<bs::string_viewt<Traits>, typename Traits::char_type, Offset> split_index(Executor&& executor,
+    const bs::detail::type_identity_t<bs::string_viewt<Traits>> str, const typename Traits::char_type separator,
+    const std::size_t chunk_size = default_chunk_size) {
+    using fields_type = split_fields<bs::string_viewt<Traits>, typename Traits::char_type, Offset>;
+    if (bs::detail::cmp_greater(str.size(), (std::numeric_limits<Offset>::max)())) {
+        throw std::length_error("the string is too long for the offset type");
+    }
+    return fields_type::from_separator_offsets(str, separator, detail::find_all<Offset>(executor, str, separator, chunk_size));
+}
+template<class Offset = std::uint32_t, class Executor, class Traits = char_traits<char>>
+split_fields<bs::string_viewt<Traits>, bs::string_viewt<Traits>, Offset> split_index(Executor&& executor,
+    const bs::detail::type_identity_t<bs::string_viewt<Traits>> str, const bs::detail::type_identity_t<bs::string_viewt<Traits>> separator,
+    const std::size_t chunk_size = default_chunk_size) {
+    using fields_type = split_fields<bs::string_viewt<Traits>, bs::string_viewt<Traits>, Offset>;
+    if (bs::detail::cmp_greater(str.size(), (std::numeric_limits<Offset>::max)())) {
+        throw std::length_error("the string is too long for the offset type");
+    }
+    return fields_type::from_separator_offsets(str, separator, detail::find_all<Offset>(executor, str, separator, chunk_size));
+}
+template<class Offset = std::uint32_t, class Traits = char_traits<char>>
+split_fields<bs::string_viewt<Traits>, typename Traits::char_type, Offset> split_index(const bs::detail::type_identity_t<bs::string_viewt<Traits>> str,
+    const typename Traits::char_type separator) {
+    return par::split_index<Offset, thread_pool&, Traits>(default_pool(), str, separator);
+}
+template<class Offset = std::uint32_t, class Traits = char_traits<char>>
+split_fields<bs::string_viewt<Traits>, bs::string_viewt<Traits>, Offset> split_index(const bs::detail::type_identity_t<bs::string_viewt<Traits>> str,
+    const bs::detail::type_identity_t<bs::string_viewt<Traits>> separator) {
+    return par::split_index<Offset, thread_pool&, Traits>(default_pool(), str, separator);
+}
+
+}
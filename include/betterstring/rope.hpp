@@ -0,0 +1,583 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <betterstring/string.hpp>
+#include <betterstring/string_view.hpp>
+#include <betterstring/allocators.hpp>
+#include <betterstring/stream_searcher.hpp>
+#include <betterstring/detail/preprocessor.hpp>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace bs {
+
+// String stored in the leaves of a balanced (AVL) tree, for very large and frequently edited text.
+// Insertion, erasure and concatenation split and join the tree, which takes O(log n) besides the copied characters.
+// The leaves hold up to 4 KB of characters, the nodes are recycled by the `string_pool` of the rope.
+// The pool caches at most `max_cached_nodes` nodes of every size, the other freed nodes are returned to the global
+// operator delete, so an erased rope keeps at most 256 KB of cached leaves.
+template<class Traits>
+class ropet {
+public:
+    using traits_type = Traits;
+    using value_type = typename Traits::char_type;
+    using size_type = typename Traits::size_type;
+    using string_view_type = bs::string_viewt<Traits>;
+
+    static constexpr size_type npos = static_cast<size_type>(-1);
+private:
+    struct node {
+        // the number of characters in the subtree
+        size_type size;
+        // leaves have the height 1
+        size_type height;
+        node* left;
+        node* right;
+    };
+public:
+    // the allocation of a leaf, the characters follow the node header
+    static constexpr std::size_t leaf_bytes = 4096;
+    static constexpr size_type leaf_capacity = (leaf_bytes - sizeof(node)) / sizeof(value_type);
+    // the number of the freed leaves and the freed internal nodes kept by the pool for the next insertions
+    static constexpr std::size_t max_cached_nodes = 64;
+
+    // Forward iterator over the leaves of the rope, yields their characters as views.
+    // Moving to the next chunk takes O(log n), the iterators are invalidated by any modification of the rope.
+    class chunk_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = string_view_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = string_view_type;
+
+        chunk_iterator() noexcept = default;
+
+        string_view_type operator*() const noexcept {
+            return string_view_type(characters(leaf), leaf->size);
+        }
+        chunk_iterator& operator++() noexcept {
+            offset += leaf->size;
+            leaf = locate(root, offset).leaf;
+            return *this;
+        }
+        chunk_iterator operator++(int) noexcept {
+            chunk_iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+        // the position of the first character of the chunk in the rope
+        size_type position() const noexcept { return offset; }
+
+        friend bool operator==(const chunk_iterator& left, const chunk_iterator& right) noexcept { return left.leaf == right.leaf; }
+        friend bool operator!=(const chunk_iterator& left, const chunk_iterator& right) noexcept { return left.leaf != right.leaf; }
+
+    private:
+        friend class ropet;
+
+        chunk_iterator(const node* const root_, const size_type position) noexcept
+            : root(root_) {
+            const location found = locate(root, position);
+            leaf = found.leaf;
+            offset = found.leaf_start;
+        }
+
+        const node* root = nullptr;
+        const node* leaf = nullptr;
+        size_type offset = 0;
+    };
+
+    class chunk_range {
+    public:
+        chunk_iterator begin() const noexcept { return first; }
+        chunk_iterator end() const noexcept { return chunk_iterator(); }
+    private:
+        friend class ropet;
+        explicit chunk_range(const chunk_iterator first_) noexcept : first(first_) {}
+        chunk_iterator first;
+    };
+
+    ropet() noexcept = default;
+    explicit ropet(const string_view_type str) {
+        root = build(str.data(), str.size());
+    }
+    ropet(const ropet& other) {
+        append(other);
+    }
+    ropet(ropet&& other) noexcept
+        : root(std::exchange(other.root, nullptr)) {}
+
+    ropet& operator=(const ropet& other) {
+        if (this != &other) {
+            ropet(other).swap(*this);
+        }
+        return *this;
+    }
+    ropet& operator=(ropet&& other) noexcept {
+        ropet(std::move(other)).swap(*this);
+        return *this;
+    }
+    ropet& operator=(const string_view_type str) {
+        ropet(str).swap(*this);
+        return *this;
+    }
+
+    ~ropet() noexcept {
+        destroy(root);
+    }
+
+    // The pools are not exchanged, the nodes of one pool may be returned into another one.
+    void swap(ropet& other) noexcept {
+        std::swap(root, other.root);
+    }
+
+    void clear() noexcept {
+        destroy(root);
+        root = nullptr;
+    }
+
+    size_type size() const noexcept { return size_of(root); }
+    [[nodiscard]] bool empty() const noexcept { return root == nullptr; }
+    // the height of the tree, O(log n) of the number of leaves
+    size_type height() const noexcept { return height_of(root); }
+
+    void append(const string_view_type str) {
+        insert(size(), str);
+    }
+    // Moves the characters of `other` to the end of this rope in O(log n), `other` becomes empty.
+    void append(ropet&& other) {
+        if (this == &other) {
+            append(static_cast<const ropet&>(other));
+            return;
+        }
+        root = join(root, std::exchange(other.root, nullptr));
+    }
+    void append(const ropet& other) {
+        if (this == &other) {
+            const ropet copy(other);
+            append(copy);
+            return;
+        }
+        for (const string_view_type chunk : other.chunks()) {
+            append(chunk);
+        }
+    }
+    ropet& operator+=(const string_view_type str) {
+        append(str);
+        return *this;
+    }
+
+    // Inserts `str` before the character at `position`.
+    // The characters are inserted into the leaf if it has room, otherwise the tree is split at the position.
+    void insert(const size_type position, const string_view_type str) {
+        BS_VERIFY(position <= size(), "the insert position exceeds the length of the rope");
+        if (str.empty()) { return; }
+        if (root != nullptr && insert_into_leaf(root, position, str)) { return; }
+        auto [left, right] = split(root, position);
+        root = join(join(left, build(str.data(), str.size())), right);
+    }
+    // Moves the characters of `other` into this rope before the character at `position` in O(log n).
+    void insert(const size_type position, ropet&& other) {
+        BS_VERIFY(position <= size(), "the insert position exceeds the length of the rope");
+        BS_VERIFY(this != &other, "the rope can not be inserted into itself");
+        auto [left, right] = split(root, position);
+        root = join(join(left, std::exchange(other.root, nullptr)), right);
+    }
+
+    void erase(const size_type position, const size_type count) {
+        BS_VERIFY(position <= size(), "the erase position exceeds the length of the rope");
+        BS_VERIFY(count <= size() - position, "the erased range exceeds the length of the rope");
+        if (count == 0) { return; }
+        if (erase_from_leaf(root, position, count)) { return; }
+        auto [left, rest] = split(root, position);
+        auto [erased, right] = split(rest, count);
+        destroy(erased);
+        root = join(left, right);
+    }
+
+    template<class Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+    value_type operator[](const Int index) const noexcept {
+        BS_VERIFY((index + Int(size())) >= 0 && index < Int(size()), "index is out of range");
+        const size_type position = static_cast<size_type>(index < 0 ? index + Int(size()) : index);
+        const location found = locate(root, position);
+        return characters(found.leaf)[position - found.leaf_start];
+    }
+
+    chunk_range chunks() const noexcept {
+        return chunk_range(chunk_iterator(root, 0));
+    }
+    // the chunks starting with the one which contains the character at `position`
+    chunk_range chunks(const size_type position) const noexcept {
+        BS_VERIFY(position <= size(), "the position exceeds the length of the rope");
+        return chunk_range(chunk_iterator(root, position));
+    }
+
+    // Returns the position of the first occurrence of `ch` at or after `position`, or `npos`.
+    size_type find(const value_type ch, const size_type position = 0) const noexcept {
+        if (position >= size()) { return npos; }
+        for (auto it = chunks(position).begin(); it != chunk_iterator(); ++it) {
+            const string_view_type chunk = *it;
+            const size_type skip = position > it.position() ? position - it.position() : 0;
+            const value_type* const found = Traits::find(chunk.data() + skip, chunk.size() - skip, ch);
+            if (found != nullptr) {
+                return it.position() + static_cast<size_type>(found - chunk.data());
+            }
+        }
+        return npos;
+    }
+    // Returns the position of the first occurrence of `str` at or after `position`, or `npos`.
+    // The chunks are searched with `Traits::findstr`, the matches across the chunks are searched in the joined boundaries.
+    size_type find(const string_view_type str, const size_type position = 0) const {
+        if (position > size()) { return npos; }
+        if (str.empty()) { return position; }
+        size_type result = npos;
+        for_each_match(str, position, [&](const size_type found) {
+            result = found;
+            return false;
+        });
+        return result;
+    }
+
+    size_type count(const value_type ch) const noexcept {
+        size_type result = 0;
+        for (const string_view_type chunk : chunks()) {
+            result += chunk.count(ch);
+        }
+        return result;
+    }
+    // Counts the occurrences of `str`, they may overlap as in `string_viewt::count`.
+    size_type count(const string_view_type str) const {
+        if (str.empty()) { return size() + 1; }
+        size_type result = 0;
+        for_each_match(str, 0, [&](size_type) {
+            ++result;
+            return true;
+        });
+        return result;
+    }
+
+    bool contains(const value_type ch) const noexcept { return find(ch) != npos; }
+    bool contains(const string_view_type str) const { return find(str) != npos; }
+
+    // Calls `on_field(field)` for the same fields as `str.split(separator)` of the whole text.
+    // The fields inside of one chunk are views into the chunk, the fields across the chunks are copied.
+    // The field is valid only during the call.
+    template<class F>
+    void split(const string_view_type separator, F&& on_field) const {
+        stream_splittert<Traits> splitter(separator);
+        for (const string_view_type chunk : chunks()) {
+            splitter.feed(chunk, on_field);
+        }
+        splitter.finish(on_field);
+    }
+
+    stringt<Traits> to_string() const {
+        stringt<Traits> out = stringt<Traits>::with_capacity(size());
+        for (const string_view_type chunk : chunks()) {
+            out.append(chunk);
+        }
+        return out;
+    }
+    stringt<Traits> to_string(const size_type position, const size_type count) const {
+        BS_VERIFY(position <= size(), "the start position exceeds the length of the rope");
+        BS_VERIFY(count <= size() - position, "the copied range exceeds the length of the rope");
+        stringt<Traits> out = stringt<Traits>::with_capacity(count);
+        for (auto it = chunks(position).begin(); out.size() < count; ++it) {
+            const string_view_type chunk = *it;
+            const size_type skip = position > it.position() ? position - it.position() : 0;
+            const size_type rest = count - out.size();
+            out.append(chunk.substr(skip, chunk.size() - skip < rest ? chunk.size() - skip : rest));
+        }
+        return out;
+    }
+
+    friend bool operator==(const ropet& left, const string_view_type right) noexcept {
+        if (left.size() != right.size()) { return false; }
+        for (auto it = left.chunks().begin(); it != chunk_iterator(); ++it) {
+            const string_view_type chunk = *it;
+            if (chunk != right.substr(it.position(), chunk.size())) { return false; }
+        }
+        return true;
+    }
+    friend bool operator==(const string_view_type left, const ropet& right) noexcept { return right == left; }
+    friend bool operator!=(const ropet& left, const string_view_type right) noexcept { return !(left == right); }
+    friend bool operator!=(const string_view_type left, const ropet& right) noexcept { return !(right == left); }
+
+    friend bool operator==(const ropet& left, const ropet& right) noexcept {
+        if (left.size() != right.size()) { return false; }
+        auto right_it = right.chunks().begin();
+        size_type right_skip = 0;
+        for (const string_view_type chunk : left.chunks()) {
+            string_view_type rest = chunk;
+            while (!rest.empty()) {
+                const string_view_type other = (*right_it).substr(right_skip);
+                const size_type compared = rest.size() < other.size() ? rest.size() : other.size();
+                if (Traits::compare(rest.data(), other.data(), compared) != 0) { return false; }
+                rest.remove_prefix(compared);
+                right_skip += compared;
+                if (right_skip == (*right_it).size()) {
+                    ++right_it;
+                    right_skip = 0;
+                }
+            }
+        }
+        return true;
+    }
+    friend bool operator!=(const ropet& left, const ropet& right) noexcept { return !(left == right); }
+
+private:
+    struct location {
+        const node* leaf;
+        size_type leaf_start;
+    };
+
+    static size_type size_of(const node* const n) noexcept { return n == nullptr ? 0 : n->size; }
+    static size_type height_of(const node* const n) noexcept { return n == nullptr ? 0 : n->height; }
+    static bool is_leaf(const node* const n) noexcept { return n->height == 1; }
+
+    static value_type* characters(node* const leaf) noexcept {
+        return reinterpret_cast<value_type*>(leaf + 1);
+    }
+    static const value_type* characters(const node* const leaf) noexcept {
+        return reinterpret_cast<const value_type*>(leaf + 1);
+    }
+
+    // the leaf which contains the character at `position`, `nullptr` if the position is the end
+    static location locate(const node* n, size_type position) noexcept {
+        if (position >= size_of(n)) { return location{nullptr, 0}; }
+        size_type leaf_start = 0;
+        while (!is_leaf(n)) {
+            if (position < n->left->size) {
+                n = n->left;
+            } else {
+                position -= n->left->size;
+                leaf_start += n->left->size;
+                n = n->right;
+            }
+        }
+        return location{n, leaf_start};
+    }
+
+    node* allocate_leaf() {
+        void* const memory = pool.allocate(leaf_bytes, alignof(node));
+        return ::new(memory) node{0, 1, nullptr, nullptr};
+    }
+    node* make_internal(node* const left, node* const right) {
+        void* const memory = pool.allocate(sizeof(node), alignof(node));
+        node* const n = ::new(memory) node{0, 0, left, right};
+        update(n);
+        return n;
+    }
+    void free_node(node* const n) noexcept {
+        pool.deallocate(n, is_leaf(n) ? leaf_bytes : sizeof(node), alignof(node));
+    }
+    void destroy(node* const n) noexcept {
+        if (n == nullptr) { return; }
+        if (!is_leaf(n)) {
+            destroy(n->left);
+            destroy(n->right);
+        }
+        free_node(n);
+    }
+
+    static void update(node* const n) noexcept {
+        n->size = n->left->size + n->right->size;
+        n->height = 1 + (n->left->height > n->right->height ? n->left->height : n->right->height);
+    }
+    static node* rotate_left(node* const n) noexcept {
+        node* const right = n->right;
+        n->right = right->left;
+        right->left = n;
+        update(n);
+        update(right);
+        return right;
+    }
+    static node* rotate_right(node* const n) noexcept {
+        node* const left = n->left;
+        n->left = left->right;
+        left->right = n;
+        update(n);
+        update(left);
+        return left;
+    }
+    // restores the AVL invariant of the node whose subtrees differ in height by at most 2
+    static node* rebalance(node* const n) noexcept {
+        update(n);
+        if (n->left->height > n->right->height + 1) {
+            if (n->left->left->height < n->left->right->height) {
+                n->left = rotate_left(n->left);
+            }
+            return rotate_right(n);
+        }
+        if (n->right->height > n->left->height + 1) {
+            if (n->right->right->height < n->right->left->height) {
+                n->right = rotate_right(n->right);
+            }
+            return rotate_left(n);
+        }
+        return n;
+    }
+
+    // Concatenates two trees, descends along the spine of the higher one to the subtree of the height of the lower one.
+    node* join(node* const left, node* const right) {
+        if (left == nullptr) { return right; }
+        if (right == nullptr) { return left; }
+        if (is_leaf(left) && is_leaf(right) && left->size + right->size <= leaf_capacity) {
+            Traits::copy(characters(left) + left->size, characters(right), right->size);
+            left->size += right->size;
+            free_node(right);
+            return left;
+        }
+        if (left->height > right->height + 1) {
+            left->right = join(left->right, right);
+            return rebalance(left);
+        }
+        if (right->height > left->height + 1) {
+            right->left = join(left, right->left);
+            return rebalance(right);
+        }
+        return make_internal(left, right);
+    }
+
+    // Splits the tree into the first `position` characters and the rest, the internal nodes on the path are freed.
+    std::pair<node*, node*> split(node* const n, const size_type position) {
+        if (n == nullptr) { return {nullptr, nullptr}; }
+        if (position == 0) { return {nullptr, n}; }
+        if (position == n->size) { return {n, nullptr}; }
+        if (is_leaf(n)) {
+            node* const right = allocate_leaf();
+            right->size = n->size - position;
+            Traits::copy(characters(right), characters(n) + position, right->size);
+            n->size = position;
+            return {n, right};
+        }
+        node* const left_child = n->left;
+        node* const right_child = n->right;
+        free_node(n);
+        if (position <= left_child->size) {
+            auto [first, second] = split(left_child, position);
+            return {first, join(second, right_child)};
+        }
+        auto [first, second] = split(right_child, position - left_child->size);
+        return {join(left_child, first), second};
+    }
+
+    // builds the balanced tree of full leaves
+    node* build(const value_type* const str, const size_type count) {
+        if (count == 0) { return nullptr; }
+        const size_type leaf_count = (count + leaf_capacity - 1) / leaf_capacity;
+        return build_leaves(str, count, leaf_count);
+    }
+    node* build_leaves(const value_type* const str, const size_type count, const size_type leaf_count) {
+        if (leaf_count == 1) {
+            node* const leaf = allocate_leaf();
+            Traits::copy(characters(leaf), str, count);
+            leaf->size = count;
+            return leaf;
+        }
+        const size_type left_leaves = leaf_count / 2;
+        const size_type left_count = count - (leaf_count - left_leaves) * (count / leaf_count);
+        const size_type split_count = left_count < left_leaves * leaf_capacity ? left_count : left_leaves * leaf_capacity;
+        node* const left = build_leaves(str, split_count, left_leaves);
+        node* const right = build_leaves(str + split_count, count - split_count, leaf_count - left_leaves);
+        return make_internal(left, right);
+    }
+
+    // inserts the characters into the leaf which contains the position if it has room, updates the sizes on the path
+    static bool insert_into_leaf(node* const n, const size_type position, const string_view_type str) noexcept {
+        if (is_leaf(n)) {
+            if (n->size + str.size() > leaf_capacity) { return false; }
+            value_type* const chars = characters(n);
+            Traits::move(chars + position + str.size(), chars + position, n->size - position);
+            Traits::copy(chars + position, str.data(), str.size());
+            n->size += str.size();
+            return true;
+        }
+        // the position between two leaves goes to the end of the left one
+        const bool inserted = position <= n->left->size
+            ? insert_into_leaf(n->left, position, str)
+            : insert_into_leaf(n->right, position - n->left->size, str);
+        if (inserted) {
+            n->size += str.size();
+        }
+        return inserted;
+    }
+    // erases the characters from the leaf which contains the whole range and keeps at least one character
+    static bool erase_from_leaf(node* const n, const size_type position, const size_type count) noexcept {
+        if (is_leaf(n)) {
+            if (count >= n->size) { return false; }
+            value_type* const chars = characters(n);
+            Traits::move(chars + position, chars + position + count, n->size - position - count);
+            n->size -= count;
+            return true;
+        }
+        bool erased = false;
+        if (position + count <= n->left->size) {
+            erased = erase_from_leaf(n->left, position, count);
+        } else if (position >= n->left->size) {
+            erased = erase_from_leaf(n->right, position - n->left->size, count);
+        }
+        if (erased) {
+            n->size -= count;
+        }
+        return erased;
+    }
+
+    // Calls `on_match(position)` for the positions of the occurrences of `str` at or after `first` in increasing order,
+    // stops if it returns false. The occurrences inside of a chunk are found in the chunk, the occurrences which start
+    // in the last `str.size() - 1` characters before the chunk are found in these characters joined with the start of the chunk.
+    template<class F>
+    void for_each_match(const string_view_type str, const size_type first, F&& on_match) const {
+        const size_type overlap = str.size() - 1;
+        stringt<Traits> window;
+        for (auto it = chunks(first).begin(); it != chunk_iterator(); ++it) {
+            string_view_type chunk = *it;
+            size_type chunk_start = it.position();
+            if (chunk_start < first) {
+                chunk.remove_prefix(first - chunk_start);
+                chunk_start = first;
+            }
+            if (window.size() != 0) {
+                const size_type tail = window.size();
+                window.append(chunk.substr(0, chunk.size() < overlap ? chunk.size() : overlap));
+                const value_type* const window_data = window.data();
+                for (const value_type* found = window_data; ; ++found) {
+                    const size_type rest = window.size() - static_cast<size_type>(found - window_data);
+                    found = Traits::findstr(found, rest, str.data(), str.size());
+                    if (found == nullptr || static_cast<size_type>(found - window_data) >= tail) { break; }
+                    if (!on_match(chunk_start - tail + static_cast<size_type>(found - window_data))) { return; }
+                }
+                window.erase(tail);
+            }
+            for (const value_type* found = chunk.data(); ; ++found) {
+                const size_type rest = chunk.size() - static_cast<size_type>(found - chunk.data());
+                found = Traits::findstr(found, rest, str.data(), str.size());
+                if (found == nullptr) { break; }
+                if (!on_match(chunk_start + static_cast<size_type>(found - chunk.data()))) { return; }
+            }
+            // the last `overlap` characters of the text before the next chunk
+            if (chunk.size() >= overlap) {
+                window.clear();
+                window.append(chunk.substr(chunk.size() - overlap));
+            } else {
+                window.append(chunk);
+                if (window.size() > overlap) {
+                    window.remove_prefix_inplace(window.size() - overlap);
+                }
+            }
+        }
+    }
+
+    node* root = nullptr;
+    string_pool pool{max_cached_nodes};
+};
+
+using rope = ropet<char_traits<char>>;
+
+}
@@ -0,0 +1,269 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <betterstring/char_traits.hpp>
+#include <betterstring/string_view.hpp>
+#include <betterstring/hash.hpp>
+#include <betterstring/detail/preprocessor.hpp>
+#include <betterstring/detail/reference_wrapper.hpp>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace bs {
+
+namespace detail {
+    template<bool ThreadSafe>
+    struct shared_count;
+
+    template<>
+    struct shared_count<true> {
+        void increment() noexcept {
+            value.fetch_add(1, std::memory_order_relaxed);
+        }
+        // returns true if the last reference is released
+        bool decrement() noexcept {
+            if (value.fetch_sub(1, std::memory_order_release) == 1) {
+                std::atomic_thread_fence(std::memory_order_acquire);
+                return true;
+            }
+            return false;
+        }
+        std::size_t get() const noexcept { return value.load(std::memory_order_relaxed); }
+
+        std::atomic<std::size_t> value{1};
+    };
+
+    template<>
+    struct shared_count<false> {
+        void increment() noexcept { ++value; }
+        bool decrement() noexcept { return --value == 0; }
+        std::size_t get() const noexcept { return value; }
+
+        std::size_t value = 1;
+    };
+
+    // the header of the allocation, the characters follow it
+    template<bool ThreadSafe>
+    struct shared_string_header {
+        shared_count<ThreadSafe> count;
+        std::size_t capacity;
+    };
+}
+
+// Immutable string which shares one allocation between its copies, a copy only increments the reference count.
+// The reference count and the characters are in the same allocation, and `substr` returns a string
+// which refers to the characters of the parent allocation. The reference count is atomic if `ThreadSafe` is true.
+template<class Traits, bool ThreadSafe = true>
+class shared_stringt {
+public:
+    using traits_type = Traits;
+    using value_type = typename Traits::char_type;
+    using size_type = typename Traits::size_type;
+
+    using const_pointer = const value_type*;
+    using const_reference = const value_type&;
+    using const_iterator = const value_type*;
+    using iterator = const_iterator;
+private:
+    using header = detail::shared_string_header<ThreadSafe>;
+    using self_string_view = bs::string_viewt<Traits>;
+    using optional_char_const_reference = std::optional<detail::reference_wrapper<const value_type>>;
+
+    static_assert(alignof(value_type) <= alignof(header), "the characters must be aligned after the header");
+public:
+
+    shared_stringt() noexcept = default;
+
+    // Copies the characters into a new allocation, the empty string does not allocate.
+    shared_stringt(const const_pointer str, const size_type str_len) {
+        if (str_len == 0) { return; }
+        buffer = allocate(str_len);
+        value_type* const chars = characters(buffer);
+        Traits::copy(chars, str, str_len);
+        str_data = chars;
+        str_size = str_len;
+    }
+    explicit shared_stringt(const self_string_view str_view)
+        : shared_stringt(str_view.data(), str_view.size()) {}
+
+    shared_stringt(const shared_stringt& other) noexcept
+        : buffer(other.buffer), str_data(other.str_data), str_size(other.str_size) {
+        if (buffer != nullptr) {
+            buffer->count.increment();
+        }
+    }
+    shared_stringt(shared_stringt&& other) noexcept
+        : buffer(std::exchange(other.buffer, nullptr)),
+        str_data(std::exchange(other.str_data, nullptr)),
+        str_size(std::exchange(other.str_size, 0)) {}
+
+    shared_stringt& operator=(const shared_stringt& other) noexcept {
+        shared_stringt(other).swap(*this);
+        return *this;
+    }
+    shared_stringt& operator=(shared_stringt&& other) noexcept {
+        shared_stringt(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    ~shared_stringt() noexcept {
+        release();
+    }
+
+    void swap(shared_stringt& other) noexcept {
+        std::swap(buffer, other.buffer);
+        std::swap(str_data, other.str_data);
+        std::swap(str_size, other.str_size);
+    }
+
+    // The substring shares the allocation with this string, no characters are copied.
+    shared_stringt substr(const size_type position) const noexcept {
+        BS_VERIFY(position <= size(), "the start position of the substring exceeds the length of the string");
+        return shared_stringt(*this, position, size() - position);
+    }
+    shared_stringt substr(const size_type position, const size_type count) const noexcept {
+        BS_VERIFY(position <= size(), "the start position of the substring exceeds the length of the string");
+        BS_VERIFY(count <= size() - position, "the length of substring exceeds the length of the string");
+        return shared_stringt(*this, position, count);
+    }
+
+    constexpr bool contains(const value_type ch) const noexcept {
+        return view().contains(ch);
+    }
+    constexpr bool contains(const self_string_view str) const noexcept {
+        return view().contains(str);
+    }
+    constexpr bool starts_with(const value_type ch) const noexcept {
+        return view().starts_with(ch);
+    }
+    constexpr bool starts_with(const self_string_view str) const noexcept {
+        return view().starts_with(str);
+    }
+    constexpr bool ends_with(const value_type ch) const noexcept {
+        return view().ends_with(ch);
+    }
+    constexpr bool ends_with(const self_string_view str) const noexcept {
+        return view().ends_with(str);
+    }
+
+    constexpr const_pointer data() const noexcept BS_LIFETIMEBOUND { return str_data; }
+    constexpr size_type size() const noexcept { return str_size; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return str_size == 0; }
+
+    constexpr const_iterator begin() const noexcept BS_LIFETIMEBOUND { return data(); }
+    constexpr const_iterator end() const noexcept BS_LIFETIMEBOUND { return data() + size(); }
+
+    template<class Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+    constexpr const_reference operator[](const Int index) const noexcept BS_LIFETIMEBOUND {
+        BS_VERIFY((index + Int(size())) >= 0 && index < Int(size()), "index is out of range");
+        return data()[index < 0 ? index + Int(size()) : index];
+    }
+    template<class Int, std::enable_if_t<std::is_integral_v<Int>, int> = 0>
+    constexpr optional_char_const_reference at(const Int index) const noexcept BS_LIFETIMEBOUND {
+        if (index + Int(size()) < 0 || index >= Int(size())) {
+            return std::nullopt;
+        }
+        return data()[index < 0 ? index + Int(size()) : index];
+    }
+
+    constexpr const_reference front() const noexcept BS_LIFETIMEBOUND {
+        BS_VERIFY(size() >= 1, "cannot access the first element from an empty string");
+        return data()[0];
+    }
+    constexpr const_reference back() const noexcept BS_LIFETIMEBOUND {
+        BS_VERIFY(size() >= 1, "cannot access the last element from an empty string");
+        return data()[size() - 1];
+    }
+
+    // the number of strings sharing the allocation, zero for the empty string which does not own one
+    size_type use_count() const noexcept {
+        return buffer == nullptr ? 0 : buffer->count.get();
+    }
+
+    constexpr self_string_view view() const noexcept BS_LIFETIMEBOUND {
+        return self_string_view{data(), size()};
+    }
+    // Explicit, the view must not outlive the last string sharing the allocation.
+    explicit constexpr operator self_string_view() const noexcept BS_LIFETIMEBOUND {
+        return view();
+    }
+
+    friend bool operator==(const shared_stringt& left, const shared_stringt& right) noexcept {
+        return left.view() == right.view();
+    }
+    friend bool operator!=(const shared_stringt& left, const shared_stringt& right) noexcept {
+        return left.view() != right.view();
+    }
+    friend bool operator==(const shared_stringt& left, const self_string_view right) noexcept {
+        return left.view() == right;
+    }
+    friend bool operator==(const self_string_view left, const shared_stringt& right) noexcept {
+        return left == right.view();
+    }
+    friend bool operator!=(const shared_stringt& left, const self_string_view right) noexcept {
+        return left.view() != right;
+    }
+    friend bool operator!=(const self_string_view left, const shared_stringt& right) noexcept {
+        return left != right.view();
+    }
+
+private:
+    shared_stringt(const shared_stringt& parent, const size_type position, const size_type count) noexcept
+        : buffer(count == 0 ? nullptr : parent.buffer), str_data(count == 0 ? nullptr : parent.str_data + position), str_size(count) {
+        if (buffer != nullptr) {
+            buffer->count.increment();
+        }
+    }
+
+    static value_type* characters(header* const allocation) noexcept {
+        return reinterpret_cast<value_type*>(allocation + 1);
+    }
+
+    static header* allocate(const size_type capacity) {
+        void* const memory = ::operator new(sizeof(header) + capacity * sizeof(value_type));
+        return ::new (memory) header{{}, capacity};
+    }
+
+    void release() noexcept {
+        if (buffer != nullptr && buffer->count.decrement()) {
+            const std::size_t bytes = sizeof(header) + buffer->capacity * sizeof(value_type);
+            buffer->~header();
+            ::operator delete(static_cast<void*>(buffer), bytes);
+        }
+    }
+
+    header* buffer = nullptr;
+    const value_type* str_data = nullptr;
+    size_type str_size = 0;
+};
+
+using shared_string = shared_stringt<char_traits<char>, true>;
+// shared string with the non-atomic reference count, its copies must be used by one thread
+using local_shared_string = shared_stringt<char_traits<char>, false>;
+
+template<class Traits, bool ThreadSafe>
+struct hash<shared_stringt<Traits, ThreadSafe>> {
+    using is_transparent = void;
+
+    std::size_t operator()(const shared_stringt<Traits, ThreadSafe>& str) const noexcept {
+        return static_cast<std::size_t>(bs::hash_string<Traits>(str.view()));
+    }
+    constexpr std::size_t operator()(const bs::string_viewt<Traits> str) const noexcept {
+        return static_cast<std::size_t>(bs::hash_string<Traits>(str));
+    }
+};
+
+}
+
+namespace std {
+    template<class Traits, bool ThreadSafe>
+    struct hash<bs::shared_stringt<Traits, ThreadSafe>> : bs::hash<bs::shared_stringt<Traits, ThreadSafe>> {};
+}
@@ -0,0 +1,328 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <betterstring/char_traits.hpp>
+#include <betterstring/string_view.hpp>
+#include <betterstring/parallel.hpp>
+#include <betterstring/detail/preprocessor.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace bs {
+
+enum class string_order {
+    // the character by character order, a prefix precedes the longer strings
+    lexicographic,
+    // the order of `string_viewt::operator<`: the shorter strings first, the strings of equal size lexicographically
+    size_first,
+};
+
+// Compares the strings lexicographically, unlike `string_viewt::operator<` which compares the sizes first.
+struct lexicographic_less {
+    template<class Traits>
+    bool operator()(const bs::string_viewt<Traits> left, const bs::string_viewt<Traits> right) const noexcept {
+        const std::size_t common = left.size() < right.size() ? left.size() : right.size();
+        const int result = Traits::compare(left.data(), right.data(), common);
+        return result < 0 || (result == 0 && left.size() < right.size());
+    }
+};
+
+namespace detail {
+    // the multikey quicksort is used for the traits which compare the characters as unsigned bytes
+    template<class Traits>
+    inline constexpr bool is_byte_sortable = sizeof(typename Traits::char_type) == 1
+        && std::is_same_v<Traits, bs::char_traits<typename Traits::char_type>>;
+
+    // the 8 characters starting at `depth` in big-endian order, the characters past the end are zero
+    template<class Traits>
+    BS_FORCEINLINE std::uint64_t string_prefix(const bs::string_viewt<Traits> str, const std::size_t depth) noexcept {
+        const unsigned char* const chars = reinterpret_cast<const unsigned char*>(str.data());
+        std::uint64_t key = 0;
+        if (str.size() >= depth + 8) {
+            for (std::size_t i = 0; i < 8; ++i) {
+                key = (key << 8) | chars[depth + i];
+            }
+            return key;
+        }
+        for (std::size_t i = depth; i < depth + 8; ++i) {
+            key = (key << 8) | (i < str.size() ? chars[i] : 0u);
+        }
+        return key;
+    }
+
+    // Multikey quicksort of the strings which are equal before `depth`, the prefixes at `depth` are cached in `keys`.
+    // The partitions by the cached prefixes compare integers, only the strings with equal prefixes load the next ones.
+    template<class Traits>
+    class string_sorter {
+    public:
+        using view_type = bs::string_viewt<Traits>;
+
+        void sort(view_type* const first, const std::size_t count) {
+            if (count < 2) { return; }
+            keys.resize(count);
+            fill_keys(first, keys.data(), count, 0);
+            sort(first, keys.data(), count, 0);
+        }
+
+    private:
+        static constexpr std::size_t insertion_sort_threshold = 16;
+
+        static void fill_keys(const view_type* const strs, std::uint64_t* const prefixes, const std::size_t count, const std::size_t depth) noexcept {
+            for (std::size_t i = 0; i < count; ++i) {
+                prefixes[i] = detail::string_prefix(strs[i], depth);
+            }
+        }
+
+        static bool less_from(const view_type left, const view_type right, const std::size_t depth) noexcept {
+            return lexicographic_less{}(left.substr(depth < left.size() ? depth : left.size()),
+                right.substr(depth < right.size() ? depth : right.size()));
+        }
+
+        static void insertion_sort(view_type* const strs, std::uint64_t* const prefixes, const std::size_t count, const std::size_t depth) noexcept {
+            for (std::size_t i = 1; i < count; ++i) {
+                const view_type str = strs[i];
+                const std::uint64_t prefix = prefixes[i];
+                std::size_t j = i;
+                for (; j > 0; --j) {
+                    const bool less = prefix != prefixes[j - 1]
+                        ? prefix < prefixes[j - 1]
+                        : less_from(str, strs[j - 1], depth);
+                    if (!less) { break; }
+                    strs[j] = strs[j - 1];
+                    prefixes[j] = prefixes[j - 1];
+                }
+                strs[j] = str;
+                prefixes[j] = prefix;
+            }
+        }
+
+        static std::uint64_t median_of_three(const std::uint64_t a, const std::uint64_t b, const std::uint64_t c) noexcept {
+            if (a < b) {
+                if (b < c) { return b; }
+                return a < c ? c : a;
+            }
+            if (a < c) { return a; }
+            return b < c ? c : b;
+        }
+
+        struct partition_range {
+            view_type* strs;
+            std::uint64_t* prefixes;
+            std::size_t count;
+            std::size_t depth;
+        };
+
+        // Only the largest of the three partitions continues the loop, the others have at most half of the strings,
+        // so the recursion depth is logarithmic even for the bad pivots and the long common prefixes.
+        void sort(view_type* strs, std::uint64_t* prefixes, std::size_t count, std::size_t depth) {
+            while (count > insertion_sort_threshold) {
+                const std::uint64_t pivot = median_of_three(prefixes[0], prefixes[count / 2], prefixes[count - 1]);
+                // three-way partition: [0, less) < pivot, [less, greater) == pivot, [greater, count) > pivot
+                std::size_t less = 0;
+                std::size_t i = 0;
+                std::size_t greater = count;
+                while (i < greater) {
+                    if (prefixes[i] < pivot) {
+                        std::swap(strs[i], strs[less]);
+                        std::swap(prefixes[i], prefixes[less]);
+                        ++less;
+                        ++i;
+                    } else if (prefixes[i] > pivot) {
+                        --greater;
+                        std::swap(strs[i], strs[greater]);
+                        std::swap(prefixes[i], prefixes[greater]);
+                    } else {
+                        ++i;
+                    }
+                }
+
+                // The strings of the equal partition which end before `depth + 8` are prefixes of the others,
+                // they are ordered by size before the rest, which is sorted by the next prefixes.
+                const std::size_t next_depth = depth + 8;
+                view_type* const longer = std::partition(strs + less, strs + greater, [next_depth](const view_type str) {
+                    return str.size() <= next_depth;
+                });
+                std::sort(strs + less, longer, [](const view_type left, const view_type right) {
+                    return left.size() < right.size();
+                });
+                const std::size_t ended = static_cast<std::size_t>(longer - (strs + less));
+                std::uint64_t* const longer_prefixes = prefixes + less + ended;
+                const std::size_t longer_count = greater - less - ended;
+                fill_keys(longer, longer_prefixes, longer_count, next_depth);
+
+                const partition_range partitions[3] = {
+                    {strs, prefixes, less, depth},
+                    {longer, longer_prefixes, longer_count, next_depth},
+                    {strs + greater, prefixes + greater, count - greater, depth},
+                };
+                std::size_t largest = 0;
+                for (std::size_t j = 1; j < 3; ++j) {
+                    if (partitions[j].count > partitions[largest].count) { largest = j; }
+                }
+                for (std::size_t j = 0; j < 3; ++j) {
+                    if (j != largest) {
+                        sort(partitions[j].strs, partitions[j].prefixes, partitions[j].count, partitions[j].depth);
+                    }
+                }
+                strs = partitions[largest].strs;
+                prefixes = partitions[largest].prefixes;
+                count = partitions[largest].count;
+                depth = partitions[largest].depth;
+            }
+            insertion_sort(strs, prefixes, count, depth);
+        }
+
+        std::vector<std::uint64_t> keys;
+    };
+
+    template<class Traits>
+    void sort_strings_lexicographic(bs::string_viewt<Traits>* const first, bs::string_viewt<Traits>* const last) {
+        if constexpr (detail::is_byte_sortable<Traits>) {
+            detail::string_sorter<Traits>{}.sort(first, static_cast<std::size_t>(last - first));
+        } else {
+            std::sort(first, last, lexicographic_less{});
+        }
+    }
+
+    template<class Traits>
+    void sort_strings_by_size(bs::string_viewt<Traits>* const first, bs::string_viewt<Traits>* const last) {
+        std::stable_sort(first, last, [](const bs::string_viewt<Traits> left, const bs::string_viewt<Traits> right) {
+            return left.size() < right.size();
+        });
+    }
+
+    template<class Executor, class = void>
+    struct executor_concurrency {
+        static std::size_t get(const Executor&) noexcept { return par::thread_pool::default_concurrency(); }
+    };
+    template<class Executor>
+    struct executor_concurrency<Executor, std::void_t<decltype(std::declval<const Executor&>().concurrency())>> {
+        static std::size_t get(const Executor& executor) noexcept { return executor.concurrency(); }
+    };
+
+    template<class T>
+    inline constexpr bool is_string_view = false;
+    template<class Traits>
+    inline constexpr bool is_string_view<bs::string_viewt<Traits>> = true;
+
+    template<class Range>
+    using range_string_view_t = std::remove_pointer_t<decltype(std::data(std::declval<Range&>()))>;
+}
+
+// Sorts the strings with the multikey quicksort on the cached 8-character prefixes.
+// The traits which do not compare the characters as unsigned bytes are sorted with `std::sort` and `lexicographic_less`.
+template<class Traits>
+void sort_strings(bs::string_viewt<Traits>* const first, bs::string_viewt<Traits>* const last,
+    const string_order order = string_order::lexicographic) {
+    detail::sort_strings_lexicographic(first, last);
+    if (order == string_order::size_first) {
+        detail::sort_strings_by_size(first, last);
+    }
+}
+template<class Range, class View = detail::range_string_view_t<Range>, std::enable_if_t<bs::detail::is_string_view<View>, int> = 0>
+void sort_strings(Range& range, const string_order order = string_order::lexicographic) {
+    bs::sort_strings(std::data(range), std::data(range) + std::size(range), order);
+}
+
+namespace par {
+
+// Sample sort: the strings are distributed into buckets by the sorted sample of the strings,
+// the buckets are sorted by `bs::sort_strings` in parallel.
+template<class Executor, class Traits>
+void sort_strings(Executor&& executor, bs::string_viewt<Traits>* const first, bs::string_viewt<Traits>* const last,
+    const string_order order = string_order::lexicographic) {
+    using view_type = bs::string_viewt<Traits>;
+    const std::size_t count = static_cast<std::size_t>(last - first);
+    const std::size_t concurrency = bs::detail::executor_concurrency<std::remove_reference_t<Executor>>::get(executor);
+    // 8 buckets per thread balance the buckets of different sizes
+    const std::size_t bucket_count = concurrency * 8;
+    const std::size_t min_parallel_count = std::size_t(1) << 14;
+    if (concurrency == 1 || count < min_parallel_count) {
+        bs::sort_strings(first, last, order);
+        return;
+    }
+
+    // 1. the splitters are the evenly spaced strings of the sorted sample
+    const std::size_t oversampling = 16;
+    std::vector<view_type> sample;
+    sample.reserve(bucket_count * oversampling);
+    for (std::size_t i = 0; i < bucket_count * oversampling; ++i) {
+        sample.push_back(first[(i * 2654435761u + count / 2) % count]);
+    }
+    bs::sort_strings(sample.data(), sample.data() + sample.size());
+    std::vector<view_type> splitters;
+    for (std::size_t i = 1; i < bucket_count; ++i) {
+        splitters.push_back(sample[i * oversampling]);
+    }
+
+    // 2. the bucket of every string and the number of strings in every bucket of every chunk
+    const std::size_t chunk_size = (count + bucket_count - 1) / bucket_count;
+    const std::size_t chunk_count = (count + chunk_size - 1) / chunk_size;
+    std::vector<std::uint32_t> buckets(count);
+    std::vector<std::size_t> offsets(chunk_count * bucket_count);
+    executor.bulk_execute(chunk_count, [&](const std::size_t chunk) {
+        const std::size_t begin = chunk * chunk_size;
+        const std::size_t end = begin + chunk_size < count ? begin + chunk_size : count;
+        std::size_t* const histogram = offsets.data() + chunk * bucket_count;
+        for (std::size_t i = begin; i < end; ++i) {
+            const auto bucket = std::upper_bound(splitters.begin(), splitters.end(), first[i], lexicographic_less{}) - splitters.begin();
+            buckets[i] = static_cast<std::uint32_t>(bucket);
+            ++histogram[bucket];
+        }
+    });
+
+    // 3. the output position of every bucket of every chunk, the buckets are ordered by the bucket and then by the chunk
+    std::vector<std::size_t> bucket_starts(bucket_count + 1);
+    std::size_t total = 0;
+    for (std::size_t bucket = 0; bucket < bucket_count; ++bucket) {
+        bucket_starts[bucket] = total;
+        for (std::size_t chunk = 0; chunk < chunk_count; ++chunk) {
+            const std::size_t size = offsets[chunk * bucket_count + bucket];
+            offsets[chunk * bucket_count + bucket] = total;
+            total += size;
+        }
+    }
+    bucket_starts[bucket_count] = total;
+
+    std::vector<view_type> scattered(count);
+    executor.bulk_execute(chunk_count, [&](const std::size_t chunk) {
+        const std::size_t begin = chunk * chunk_size;
+        const std::size_t end = begin + chunk_size < count ? begin + chunk_size : count;
+        std::size_t* const positions = offsets.data() + chunk * bucket_count;
+        for (std::size_t i = begin; i < end; ++i) {
+            scattered[positions[buckets[i]]++] = first[i];
+        }
+    });
+
+    // 4. every bucket is sorted and copied back
+    executor.bulk_execute(bucket_count, [&](const std::size_t bucket) {
+        view_type* const bucket_first = scattered.data() + bucket_starts[bucket];
+        view_type* const bucket_last = scattered.data() + bucket_starts[bucket + 1];
+        bs::detail::sort_strings_lexicographic(bucket_first, bucket_last);
+        std::copy(bucket_first, bucket_last, first + bucket_starts[bucket]);
+    });
+    if (order == string_order::size_first) {
+        bs::detail::sort_strings_by_size(first, last);
+    }
+}
+template<class Traits>
+void sort_strings(bs::string_viewt<Traits>* const first, bs::string_viewt<Traits>* const last,
+    const string_order order = string_order::lexicographic) {
+    par::sort_strings(default_pool(), first, last, order);
+}
+template<class Range, class View = bs::detail::range_string_view_t<Range>, std::enable_if_t<bs::detail::is_string_view<View>, int> = 0>
+void sort_strings(Range& range, const string_order order = string_order::lexicographic) {
+    par::sort_strings(default_pool(), std::data(range), std::data(range) + std::size(range), order);
+}
+
+}
+
+}
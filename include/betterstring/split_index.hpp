@@ -0,0 +1,169 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <betterstring/string_view.hpp>
+#include <betterstring/type_traits.hpp>
+#include <betterstring/detail/preprocessor.hpp>
+#include <betterstring/detail/integer_cmps.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace bs {
+
+template<class String, class Separator, class Offset>
+class split_fields;
+
+namespace detail {
+    template<class Fields>
+    class split_fields_iterator {
+    public:
+        // iterator traits
+        using difference_type = std::ptrdiff_t;
+        using value_type = typename Fields::string_type;
+        using size_type = typename Fields::size_type;
+        using reference = value_type;
+        using pointer = void;
+        using iterator_category = std::random_access_iterator_tag;
+
+        constexpr split_fields_iterator() noexcept = default;
+        constexpr split_fields_iterator(const Fields* const fields_, const size_type index_) noexcept
+            : fields(fields_), index(index_) {}
+
+        constexpr value_type operator*() const noexcept { return (*fields)[index]; }
+        constexpr value_type operator[](const difference_type offset) const noexcept {
+            return (*fields)[static_cast<size_type>(static_cast<difference_type>(index) + offset)];
+        }
+
+        constexpr split_fields_iterator& operator++() noexcept { ++index; return *this; }
+        constexpr split_fields_iterator operator++(int) noexcept { auto tmp = *this; ++index; return tmp; }
+        constexpr split_fields_iterator& operator--() noexcept { --index; return *this; }
+        constexpr split_fields_iterator operator--(int) noexcept { auto tmp = *this; --index; return tmp; }
+
+        constexpr split_fields_iterator& operator+=(const difference_type offset) noexcept {
+            index = static_cast<size_type>(static_cast<difference_type>(index) + offset);
+            return *this;
+        }
+        constexpr split_fields_iterator& operator-=(const difference_type offset) noexcept {
+            return *this += -offset;
+        }
+        friend constexpr split_fields_iterator operator+(split_fields_iterator it, const difference_type offset) noexcept { return it += offset; }
+        friend constexpr split_fields_iterator operator+(const difference_type offset, split_fields_iterator it) noexcept { return it += offset; }
+        friend constexpr split_fields_iterator operator-(split_fields_iterator it, const difference_type offset) noexcept { return it -= offset; }
+        friend constexpr difference_type operator-(const split_fields_iterator& left, const split_fields_iterator& right) noexcept {
+            return static_cast<difference_type>(left.index) - static_cast<difference_type>(right.index);
+        }
+
+        friend constexpr bool operator==(const split_fields_iterator& left, const split_fields_iterator& right) noexcept { return left.index == right.index; }
+        friend constexpr bool operator!=(const split_fields_iterator& left, const split_fields_iterator& right) noexcept { return left.index != right.index; }
+        friend constexpr bool operator<(const split_fields_iterator& left, const split_fields_iterator& right) noexcept { return left.index < right.index; }
+        friend constexpr bool operator>(const split_fields_iterator& left, const split_fields_iterator& right) noexcept { return left.index > right.index; }
+        friend constexpr bool operator<=(const split_fields_iterator& left, const split_fields_iterator& right) noexcept { return left.index <= right.index; }
+        friend constexpr bool operator>=(const split_fields_iterator& left, const split_fields_iterator& right) noexcept { return left.index >= right.index; }
+
+    private:
+        const Fields* fields = nullptr;
+        size_type index = 0;
+    };
+}
+
+// Fields of a string, separated by `Separator`, with the offsets of every separator computed up front.
+// The fields are the same as produced by `str.split(separator)`.
+template<class String, class Separator, class Offset = std::uint32_t>
+class split_fields {
+    static_assert(std::is_integral_v<Offset> && std::is_unsigned_v<Offset>, "offsets must be unsigned integers");
+public:
+    using string_type = String;
+    using separator_type = Separator;
+    using offset_type = Offset;
+    using size_type = typename String::size_type;
+    using iterator = detail::split_fields_iterator<split_fields>;
+    using const_iterator = iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = reverse_iterator;
+
+    // Indexes `str` reusing the memory of `offsets_buffer`.
+    split_fields(const string_type str_, const separator_type separator_, std::vector<offset_type> offsets_buffer = {})
+        : str(str_), separator(separator_), offsets(std::move(offsets_buffer)) {
+        if (detail::cmp_greater(str.size(), (std::numeric_limits<offset_type>::max)())) {
+            throw std::length_error("the string is too long for the offset type");
+        }
+        offsets.clear();
+        auto it = str.find_all(separator).begin();
+        while (true) {
+            // positions are written directly into the vector, which grows geometrically
+            const std::size_t old_size = offsets.size();
+            const std::size_t grow_size = old_size < 64 ? 64 : old_size;
+            offsets.resize(old_size + grow_size);
+            const std::size_t written = it.positions_into(offsets.data() + old_size, grow_size);
+            offsets.resize(old_size + written);
+            if (written < grow_size) { break; }
+        }
+    }
+
+    // Creates the fields from the already known positions of the separators, which must be sorted
+    // and not overlap.
+    [[nodiscard]] static split_fields from_separator_offsets(const string_type str, const separator_type separator, std::vector<offset_type> offsets) {
+        return split_fields(str, separator, std::move(offsets), offsets_tag{});
+    }
+
+    size_type size() const noexcept { return static_cast<size_type>(offsets.size() + 1); }
+
+    string_type operator[](const size_type index) const noexcept {
+        BS_VERIFY(index < size(), "field index is out of range");
+        const size_type first = index == 0 ? 0 : static_cast<size_type>(offsets[index - 1]) + separator_size();
+        const size_type last = index == offsets.size() ? str.size() : static_cast<size_type>(offsets[index]);
+        return str.substr(first, last - first);
+    }
+    string_type front() const noexcept { return (*this)[0]; }
+    string_type back() const noexcept { return (*this)[size() - 1]; }
+
+    iterator begin() const noexcept { return iterator{this, 0}; }
+    iterator end() const noexcept { return iterator{this, size()}; }
+    reverse_iterator rbegin() const noexcept { return reverse_iterator{end()}; }
+    reverse_iterator rend() const noexcept { return reverse_iterator{begin()}; }
+
+    // positions of the separators in the string
+    const std::vector<offset_type>& separator_offsets() const noexcept { return offsets; }
+    // Returns the offset buffer, so its memory can be reused to index the next string.
+    std::vector<offset_type> release_offsets() && noexcept { return std::move(offsets); }
+
+private:
+    struct offsets_tag {};
+    split_fields(const string_type str_, const separator_type separator_, std::vector<offset_type> offsets_, offsets_tag) noexcept
+        : str(str_), separator(separator_), offsets(std::move(offsets_)) {}
+
+    size_type separator_size() const noexcept {
+        if constexpr (std::is_same_v<separator_type, string_type>) {
+            return separator.size();
+        } else {
+            return 1;
+        }
+    }
+
+    string_type str;
+    separator_type separator;
+    std::vector<offset_type> offsets;
+};
+
+// Records the offsets of every separator of `str` in one pass and returns the random access range of its fields.
+template<class Offset = std::uint32_t, class Traits = char_traits<char>>
+split_fields<string_viewt<Traits>, typename Traits::char_type, Offset> split_index(const detail::type_identity_t<string_viewt<Traits>> str,
+    const typename Traits::char_type separator, std::vector<Offset> offsets_buffer = {}) {
+    return split_fields<string_viewt<Traits>, typename Traits::char_type, Offset>(str, separator, std::move(offsets_buffer));
+}
+template<class Offset = std::uint32_t, class Traits = char_traits<char>>
+split_fields<string_viewt<Traits>, string_viewt<Traits>, Offset> split_index(const detail::type_identity_t<string_viewt<Traits>> str,
+    const detail::type_identity_t<string_viewt<Traits>> separator, std::vector<Offset> offsets_buffer = {}) {
+    return split_fields<string_viewt<Traits>, string_viewt<Traits>, Offset>(str, separator, std::move(offsets_buffer));
+}
+
+}
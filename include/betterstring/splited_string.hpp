@@ -8,6 +8,7 @@
 #include <betterstring/functions.hpp>
 #include <betterstring/detail/preprocessor.hpp>
 #include <iterator>
+#include <type_traits>
 
 namespace bs {
 
@@ -26,6 +27,38 @@ namespace detail {
         }
     }
 
+    // separator matching any of the characters
+    template<class String>
+    struct any_of_separator {
+        String chars;
+    };
+
+    template<class String, class Separator>
+    constexpr typename String::size_type find_separator(const String& str, const Separator& sep) noexcept {
+        return str.find(sep).index_or_end();
+    }
+    template<class String>
+    constexpr typename String::size_type find_separator(const String& str, const any_of_separator<String>& sep) noexcept {
+        return str.find_first_of(sep.chars).index_or_end();
+    }
+
+    // the index of the last separator or -1
+    template<class String, class Separator>
+    constexpr std::make_signed_t<typename String::size_type> rfind_separator(const String& str, const Separator& sep) noexcept {
+        return str.rfind(sep).index_or_end();
+    }
+    template<class String>
+    constexpr std::make_signed_t<typename String::size_type> rfind_separator(const String& str, const any_of_separator<String>& sep) noexcept {
+        return str.find_last_of(sep.chars).index_or_end();
+    }
+
+    // null terminated like a string literal
+    template<class Char>
+    inline constexpr Char ascii_whitespace[] = {
+        static_cast<Char>(' '), static_cast<Char>('\t'), static_cast<Char>('\n'),
+        static_cast<Char>('\v'), static_cast<Char>('\f'), static_cast<Char>('\r'), Char()
+    };
+
     template<class String, class Separator>
     class splited_string_iterator {
     public:
@@ -37,9 +70,10 @@ namespace detail {
         using pointer = void;
         using iterator_category = std::input_iterator_tag;
 
-        constexpr splited_string_iterator(const String str_, const Separator sep_) noexcept
-            : str{str_}, sep{sep_} {
-            str_end = str.find(sep).index_or_end();
+        constexpr splited_string_iterator(const String str_, const Separator sep_, const size_type max_fields = size_type(-1)) noexcept
+            : str{str_}, sep{sep_}, fields_left{max_fields} {
+            BS_VERIFY(max_fields != 0, "the maximum number of fields is zero");
+            str_end = next_field_end();
         }
 
         constexpr String operator*() const noexcept {
@@ -52,7 +86,8 @@ namespace detail {
                 return *this;
             }
             str.remove_prefix(str_end + detail::size_or_1(sep));
-            str_end = str.find(sep).index_or_end();
+            if (fields_left != size_type(-1)) { --fields_left; }
+            str_end = next_field_end();
             return *this;
         }
         constexpr splited_string_iterator operator++(int) noexcept {
@@ -69,8 +104,15 @@ namespace detail {
         }
 
     private:
+        // the last allowed field contains the rest of the string
+        constexpr size_type next_field_end() const noexcept {
+            if (fields_left == 1) { return str.size(); }
+            return detail::find_separator(str, sep);
+        }
+
         String str;
         Separator sep;
+        size_type fields_left = size_type(-1);
         size_type str_end{};
     };
     template<class String, class Separator>
@@ -84,13 +126,16 @@ namespace detail {
         using pointer = void;
         using iterator_category = std::input_iterator_tag;
 
-        constexpr reverse_splited_string_iterator(const String str_, const Separator sep_) noexcept
+        constexpr reverse_splited_string_iterator(const String str_, const Separator sep_,
+            const typename String::size_type max_fields = typename String::size_type(-1)) noexcept
             : str{str_}, sep{sep_} {
-            str_end = str.rfind(sep).index_or_end();
+            BS_VERIFY(max_fields != 0, "the maximum number of fields is zero");
+            str_end = last_field_separator(max_fields);
         }
 
         constexpr String operator*() const noexcept {
-            return str(str_end + 1, {});
+            if (str_end == -1) { return str; }
+            return str(str_end + size_type(detail::size_or_1(sep)), {});
         }
 
         constexpr reverse_splited_string_iterator& operator++() noexcept {
@@ -98,8 +143,8 @@ namespace detail {
                 str_end = -2;
                 return *this;
             }
-            str.remove_suffix((str.size() - str_end - 1) + detail::size_or_1(sep));
-            str_end = str.rfind(sep).index_or_end();
+            str.remove_suffix(str.size() - typename String::size_type(str_end));
+            str_end = detail::rfind_separator(str, sep);
             return *this;
         }
         constexpr reverse_splited_string_iterator operator++(int) noexcept {
@@ -116,10 +161,142 @@ namespace detail {
         }
 
     private:
+        // The fields are the forward ones in reverse order, so the last field starts after the separator
+        // at which the forward iteration stops splitting.
+        constexpr size_type last_field_separator(const typename String::size_type max_fields) const noexcept {
+            if (max_fields != typename String::size_type(-1)) {
+                size_type separator = -1;
+                String rest = str;
+                typename String::size_type fields = 1;
+                for (; fields < max_fields; ++fields) {
+                    const auto index = detail::find_separator(rest, sep);
+                    if (index == rest.size()) { break; }
+                    separator = size_type(str.size() - rest.size() + index);
+                    rest.remove_prefix(index + detail::size_or_1(sep));
+                }
+                if (fields == max_fields) { return separator; }
+            }
+            return detail::rfind_separator(str, sep);
+        }
+
         String str;
         Separator sep;
         size_type str_end{};
     };
+
+    // yields non-empty runs of characters that are not delimiters
+    template<class String>
+    class tokenized_string_iterator {
+    public:
+        // iterator traits
+        using difference_type = std::ptrdiff_t;
+        using value_type = String;
+        using size_type = typename String::size_type;
+        using reference = String;
+        using pointer = void;
+        using iterator_category = std::input_iterator_tag;
+
+        constexpr tokenized_string_iterator(const String str_, const String delimiters_) noexcept
+            : str{str_}, delimiters{delimiters_} {
+            skip_delimiters();
+        }
+
+        constexpr String operator*() const noexcept {
+            return str(0, token_end);
+        }
+
+        constexpr tokenized_string_iterator& operator++() noexcept {
+            str.remove_prefix(token_end);
+            skip_delimiters();
+            return *this;
+        }
+        constexpr tokenized_string_iterator operator++(int) noexcept {
+            auto tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        constexpr bool operator!=(const tokenized_string_iterator&) const noexcept {
+            return token_end != size_type(-1);
+        }
+        constexpr bool operator==(const tokenized_string_iterator&) const noexcept {
+            return token_end == size_type(-1);
+        }
+
+    private:
+        constexpr void skip_delimiters() noexcept {
+            using traits_type = typename String::traits_type;
+            const auto token_start = traits_type::first_not_of(str.data(), str.size(), delimiters.data(), delimiters.size());
+            if (token_start == nullptr) {
+                token_end = size_type(-1);
+                return;
+            }
+            str.remove_prefix(static_cast<size_type>(token_start - str.data()));
+            token_end = str.find_first_of(delimiters).index_or_end();
+        }
+
+        String str;
+        String delimiters;
+        size_type token_end{};
+    };
+
+    // yields lines without the line terminators ('\n' or "\r\n"),
+    // the line terminator at the end of the string does not start a new line
+    template<class String>
+    class lines_iterator {
+    public:
+        // iterator traits
+        using difference_type = std::ptrdiff_t;
+        using value_type = String;
+        using size_type = typename String::size_type;
+        using reference = String;
+        using pointer = void;
+        using iterator_category = std::input_iterator_tag;
+
+        constexpr explicit lines_iterator(const String str_) noexcept
+            : str{str_} {
+            line_end = str.size() == 0 ? size_type(-1) : find_line_end();
+        }
+
+        constexpr String operator*() const noexcept {
+            using char_type = typename String::value_type;
+            if (line_end != 0 && str[line_end - 1] == static_cast<char_type>('\r')) {
+                return str(0, line_end - 1);
+            }
+            return str(0, line_end);
+        }
+
+        constexpr lines_iterator& operator++() noexcept {
+            if (line_end == str.size() || line_end + 1 == str.size()) {
+                line_end = size_type(-1);
+                return *this;
+            }
+            str.remove_prefix(line_end + 1);
+            line_end = find_line_end();
+            return *this;
+        }
+        constexpr lines_iterator operator++(int) noexcept {
+            auto tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        constexpr bool operator!=(const lines_iterator&) const noexcept {
+            return line_end != size_type(-1);
+        }
+        constexpr bool operator==(const lines_iterator&) const noexcept {
+            return line_end == size_type(-1);
+        }
+
+    private:
+        constexpr size_type find_line_end() const noexcept {
+            using char_type = typename String::value_type;
+            return str.find(static_cast<char_type>('\n')).index_or_end();
+        }
+
+        String str;
+        size_type line_end{};
+    };
 }
 
 template<class String, class Separator>
@@ -133,18 +310,19 @@ public:
     using reverse_iterator = detail::reverse_splited_string_iterator<string_type, separator_type>;
     using const_reverse_iterator = reverse_iterator;
 
-    constexpr splited_string(string_type str, separator_type sep) noexcept
-        : string(str), separator(sep) {}
+    constexpr splited_string(string_type str, separator_type sep, size_type max_fields_ = size_type(-1)) noexcept
+        : string(str), separator(sep), max_fields(max_fields_) {}
 
 
-    constexpr iterator begin() const noexcept { return iterator{string, separator}; }
+    constexpr iterator begin() const noexcept { return iterator{string, separator, max_fields}; }
     constexpr iterator end() const noexcept { return begin(); }
-    constexpr reverse_iterator rbegin() const noexcept { return reverse_iterator{string, separator}; }
+    constexpr reverse_iterator rbegin() const noexcept { return reverse_iterator{string, separator, max_fields}; }
     constexpr reverse_iterator rend() const noexcept { return rbegin(); }
 
 private:
     string_type string;
     separator_type separator;
+    size_type max_fields;
 };
 
 template<class String, class Separator>
@@ -171,4 +349,41 @@ private:
     separator_type separator;
 };
 
+template<class String>
+struct tokenized_string {
+public:
+    using string_type = String;
+    using size_type = typename string_type::size_type;
+    using iterator = detail::tokenized_string_iterator<string_type>;
+    using const_iterator = iterator;
+
+    constexpr tokenized_string(string_type str, string_type delimiters_) noexcept
+        : string(str), delimiters(delimiters_) {}
+
+    constexpr iterator begin() const noexcept { return iterator{string, delimiters}; }
+    constexpr iterator end() const noexcept { return begin(); }
+
+private:
+    string_type string;
+    string_type delimiters;
+};
+
+template<class String>
+struct splited_lines {
+public:
+    using string_type = String;
+    using size_type = typename string_type::size_type;
+    using iterator = detail::lines_iterator<string_type>;
+    using const_iterator = iterator;
+
+    constexpr explicit splited_lines(string_type str) noexcept
+        : string(str) {}
+
+    constexpr iterator begin() const noexcept { return iterator{string}; }
+    constexpr iterator end() const noexcept { return begin(); }
+
+private:
+    string_type string;
+};
+
 }
@@ -0,0 +1,249 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <betterstring/string.hpp>
+#include <betterstring/string_view.hpp>
+#include <betterstring/detail/preprocessor.hpp>
+#include <cstddef>
+#include <vector>
+
+namespace bs {
+
+// Searches a needle in the stream of chunks, a match may span any number of chunks.
+// The state between the chunks is the length of the matched prefix of the needle, the needle is not copied.
+template<class Traits>
+class stream_searchert {
+public:
+    using traits_type = Traits;
+    using value_type = typename Traits::char_type;
+    using size_type = typename Traits::size_type;
+    using string_view_type = bs::string_viewt<Traits>;
+
+    explicit stream_searchert(BS_LIFETIMEBOUND const string_view_type needle_)
+        : needle(needle_), prefix_function(needle_.size()) {
+        BS_VERIFY(needle.size() != 0, "searched string is empty");
+        // prefix_function[i] is the length of the longest proper prefix of needle[0..i] which is also its suffix
+        size_type length = 0;
+        for (size_type i = 1; i < needle.size(); ++i) {
+            while (length != 0 && !Traits::eq(needle[i], needle[length])) {
+                length = prefix_function[length - 1];
+            }
+            if (Traits::eq(needle[i], needle[length])) { ++length; }
+            prefix_function[i] = length;
+        }
+    }
+
+    // Searches the next chunk of the stream, calls `on_match(position)` for every match which ends in the chunk.
+    // The position is counted from the beginning of the stream, the matches do not overlap, as in `find_all`.
+    template<class F>
+    void feed(const string_view_type chunk, F&& on_match) {
+        const value_type* const first = chunk.data();
+        const size_type count = chunk.size();
+        size_type i = 0;
+        // continue the match which started in the previous chunks
+        while (i < count && matched != 0) {
+            step(first[i], stream_offset + i, on_match);
+            ++i;
+        }
+        while (i < count) {
+            const value_type* const found = needle.size() == 1
+                ? Traits::find(first + i, count - i, needle[0])
+                : Traits::findstr(first + i, count - i, needle.data(), needle.size());
+            if (found == nullptr) {
+                // a match can start only in the last `needle.size() - 1` characters
+                const size_type rest = count - i;
+                const size_type tail = rest < needle.size() - 1 ? rest : needle.size() - 1;
+                for (size_type j = count - tail; j < count; ++j) {
+                    step(first[j], stream_offset + j, on_match);
+                }
+                break;
+            }
+            const size_type position = static_cast<size_type>(found - first);
+            on_match(stream_offset + position);
+            i = position + needle.size();
+        }
+        stream_offset += count;
+    }
+
+    // the number of characters fed so far
+    size_type consumed() const noexcept { return stream_offset; }
+    // the length of the prefix of the needle matched by the end of the fed characters
+    size_type partial_match() const noexcept { return matched; }
+    string_view_type searched() const noexcept { return needle; }
+
+    // Starts a new stream.
+    void reset() noexcept {
+        stream_offset = 0;
+        matched = 0;
+    }
+
+private:
+    template<class F>
+    void step(const value_type ch, const size_type position, F& on_match) {
+        while (matched != 0 && !Traits::eq(ch, needle[matched])) {
+            matched = prefix_function[matched - 1];
+        }
+        if (Traits::eq(ch, needle[matched])) { ++matched; }
+        if (matched == needle.size()) {
+            matched = 0;
+            on_match(position + 1 - needle.size());
+        }
+    }
+
+    string_view_type needle;
+    std::vector<size_type> prefix_function;
+    size_type stream_offset = 0;
+    size_type matched = 0;
+};
+
+// Searches any of the characters in the stream of chunks.
+template<class Traits>
+class stream_any_of_searchert {
+public:
+    using traits_type = Traits;
+    using value_type = typename Traits::char_type;
+    using size_type = typename Traits::size_type;
+    using string_view_type = bs::string_viewt<Traits>;
+
+    explicit constexpr stream_any_of_searchert(BS_LIFETIMEBOUND const string_view_type chars_) noexcept
+        : chars(chars_) {}
+
+    // Searches the next chunk of the stream, calls `on_match(position)` for every character,
+    // the position is counted from the beginning of the stream.
+    template<class F>
+    constexpr void feed(const string_view_type chunk, F&& on_match) {
+        string_view_type rest = chunk;
+        while (true) {
+            const auto found = rest.find_first_of(chars);
+            if (!found.found()) { break; }
+            const size_type index = found.index();
+            on_match(stream_offset + static_cast<size_type>(rest.data() - chunk.data()) + index);
+            rest.remove_prefix(index + 1);
+        }
+        stream_offset += chunk.size();
+    }
+
+    constexpr size_type consumed() const noexcept { return stream_offset; }
+    constexpr void reset() noexcept { stream_offset = 0; }
+
+private:
+    string_view_type chars;
+    size_type stream_offset = 0;
+};
+
+// Splits the stream of chunks into the same fields as `str.split(separator)` splits the whole stream.
+// The fields inside of one chunk are passed as views into the chunk,
+// only the characters of the field which is not finished at the end of a chunk are copied.
+template<class Traits>
+class stream_splittert {
+public:
+    using traits_type = Traits;
+    using value_type = typename Traits::char_type;
+    using size_type = typename Traits::size_type;
+    using string_view_type = bs::string_viewt<Traits>;
+
+    explicit stream_splittert(BS_LIFETIMEBOUND const string_view_type separator)
+        : searcher(separator) {}
+
+    // Splits the next chunk of the stream, calls `on_field(field)` for every field which ends in the chunk.
+    // The field is valid only during the call.
+    template<class F>
+    void feed(const string_view_type chunk, F&& on_field) {
+        const size_type chunk_start = searcher.consumed();
+        const size_type separator_size = searcher.searched().size();
+        searcher.feed(chunk, [&](const size_type position) {
+            if (field_start >= chunk_start) {
+                on_field(chunk.substr(field_start - chunk_start, position - field_start));
+            } else if (position <= chunk_start) {
+                // the separator starts in one of the previous chunks
+                on_field(string_view_type(pending).substr(0, position - field_start));
+            } else {
+                pending.append(chunk.data(), position - chunk_start);
+                on_field(string_view_type(pending));
+            }
+            pending.clear();
+            field_start = position + separator_size;
+        });
+        if (field_start >= chunk_start) {
+            pending.append(chunk.substr(field_start - chunk_start));
+        } else {
+            pending.append(chunk);
+        }
+    }
+
+    // Ends the stream, calls `on_field(field)` with the last field and starts a new stream.
+    template<class F>
+    void finish(F&& on_field) {
+        on_field(string_view_type(pending));
+        reset();
+    }
+
+    // the characters of the unfinished field, they may end with a part of the separator
+    string_view_type pending_field() const noexcept { return string_view_type(pending); }
+
+    void reset() noexcept {
+        searcher.reset();
+        pending.clear();
+        field_start = 0;
+    }
+
+private:
+    stream_searchert<Traits> searcher;
+    stringt<Traits> pending;
+    size_type field_start = 0;
+};
+
+// Splits the stream of chunks into the same lines as `str.lines()` splits the whole stream.
+template<class Traits>
+class stream_line_splittert {
+public:
+    using traits_type = Traits;
+    using value_type = typename Traits::char_type;
+    using size_type = typename Traits::size_type;
+    using string_view_type = bs::string_viewt<Traits>;
+
+    stream_line_splittert()
+        : splitter(string_view_type(newline)) {}
+
+    // Splits the next chunk of the stream, calls `on_line(line)` for every line which ends in the chunk.
+    // The line does not include "\n" or "\r\n" and is valid only during the call.
+    template<class F>
+    void feed(const string_view_type chunk, F&& on_line) {
+        splitter.feed(chunk, [&](const string_view_type line) {
+            on_line(strip_carriage_return(line));
+        });
+    }
+
+    // Ends the stream, calls `on_line(line)` with the last line unless the stream is empty or ends with a newline.
+    template<class F>
+    void finish(F&& on_line) {
+        splitter.finish([&](const string_view_type line) {
+            if (!line.empty()) {
+                on_line(strip_carriage_return(line));
+            }
+        });
+    }
+
+    void reset() noexcept { splitter.reset(); }
+
+private:
+    static constexpr string_view_type strip_carriage_return(string_view_type line) noexcept {
+        if (line.ends_with(value_type('\r'))) {
+            line.remove_suffix(1);
+        }
+        return line;
+    }
+
+    static constexpr value_type newline[] = {value_type('\n'), value_type()};
+    stream_splittert<Traits> splitter;
+};
+
+using stream_searcher = stream_searchert<char_traits<char>>;
+using stream_any_of_searcher = stream_any_of_searchert<char_traits<char>>;
+using stream_splitter = stream_splittert<char_traits<char>>;
+using stream_line_splitter = stream_line_splittert<char_traits<char>>;
+
+}
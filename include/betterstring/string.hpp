@@ -12,29 +12,60 @@
 #include <type_traits>
 #include <optional>
 #include <functional>
+#include <utility>
+#include <tuple>
 
 #include <betterstring/allocators.hpp>
+#include <betterstring/growth_policy.hpp>
+#include <betterstring/string_layout.hpp>
 #include <betterstring/char_traits.hpp>
 #include <betterstring/type_traits.hpp>
 #include <betterstring/string_view.hpp>
 #include <betterstring/detail/preprocessor.hpp>
 #include <betterstring/detail/reference_wrapper.hpp>
+#include <betterstring/detail/format_integer.hpp>
 
 namespace bs {
 
 namespace detail {
-    template<class Char, class Size, Size extra_capacity>
+    // Traits may override the allocator of bs::stringt with a member type `allocator_type`.
+    // The allocator must be stateless (is_always_equal).
+    template<class Traits, class Default, class = void>
+    struct traits_allocator { using type = Default; };
+    template<class Traits, class Default>
+    struct traits_allocator<Traits, Default, std::void_t<typename Traits::allocator_type>> {
+        using type = typename Traits::allocator_type;
+    };
+
+    template<std::size_t Bytes>
+    struct representation_padding {
+        unsigned char unused[Bytes];
+    };
+    template<>
+    struct representation_padding<0> {};
+
+    // The long string flag is the highest bit of the capacity, which is the last member of the long string,
+    // and the highest bit of the short string size, which is the last byte of the short string (little endian).
+    // `extra_bytes` are added in front of the long string and extend the small string buffer.
+    template<class Char, class Size, std::size_t extra_bytes = 0>
     class string_representation {
-        struct long_string {
+        static_assert(std::is_unsigned_v<Size>, "the size type must be unsigned");
+        static_assert(extra_bytes % alignof(Char*) == 0, "the extra bytes must be a multiple of the pointer alignment");
+
+        struct long_string : representation_padding<extra_bytes> {
             Char* data;
             Size size;
             Size capacity;
         };
+        static constexpr Size long_flag = Size(1) << (sizeof(Size) * CHAR_BIT - 1);
         static constexpr std::size_t short_capacity = (sizeof(long_string) - sizeof(std::uint8_t)) / sizeof(Char);
+        static_assert(short_capacity < 128, "the short string size must fit into 7 bits");
         struct short_string {
             Char data[short_capacity];
-            std::uint8_t size;
+            // the size is the last byte
+            std::uint8_t size_bytes[sizeof(long_string) - short_capacity * sizeof(Char)];
         };
+        static constexpr std::size_t short_size_byte = sizeof(short_string::size_bytes) - 1;
         union string_rep {
             long_string long_str;
             short_string short_str;
@@ -43,39 +74,42 @@ namespace detail {
     public:
         string_representation() = default;
 
+        // the largest capacity of the long string
+        static constexpr std::size_t max_capacity = std::size_t(long_flag - 1);
+
         constexpr bool is_long() const noexcept {
             if (detail::is_constant_evaluated()) {
                 return true;
             }
-            return rep.short_str.size & (1 << 7);
+            return rep.short_str.size_bytes[short_size_byte] & (1 << 7);
         }
         constexpr void set_long_state() noexcept {
-            rep.short_str.size |= (1 << 7);
+            rep.short_str.size_bytes[short_size_byte] |= (1 << 7);
         }
         constexpr void set_short_state() noexcept {
-            rep.short_str.size &= ~(1 << 7);
+            rep.short_str.size_bytes[short_size_byte] &= ~(1 << 7);
         }
 
-        static constexpr bool fits_in_sso(const Size size) noexcept {
+        static constexpr bool fits_in_sso(const std::size_t size) noexcept {
             return size <= short_capacity;
         }
 
         constexpr Size get_short_size() const noexcept {
             BS_VERIFY(!is_long(), "string must be in short state when accessing short string size");
-            return rep.short_str.size;
+            return rep.short_str.size_bytes[short_size_byte];
         }
         constexpr Size get_long_size() const noexcept {
             BS_VERIFY(is_long(), "string must be in long state when accessing long string size");
             return rep.long_str.size;
         }
 
-        constexpr void set_short_size(const Size size) noexcept {
+        constexpr void set_short_size(const std::size_t size) noexcept {
             BS_VERIFY(size <= short_capacity, "the size of short string exceeded short string capacity");
-            rep.short_str.size = uint8_t(size);
+            rep.short_str.size_bytes[short_size_byte] = std::uint8_t(size);
         }
-        constexpr void set_long_size(const Size size) noexcept {
+        constexpr void set_long_size(const std::size_t size) noexcept {
             BS_VERIFY(size <= get_long_capacity(), "the size of long string exceeded long string capacity");
-            rep.long_str.size = size;
+            rep.long_str.size = static_cast<Size>(size);
         }
 
         constexpr Size get_short_capacity() const noexcept {
@@ -84,13 +118,13 @@ namespace detail {
         }
         constexpr Size get_long_capacity() const noexcept {
             BS_VERIFY(is_long(), "string must be in long state when accessing long string capacity");
-            return rep.long_str.capacity & ~(uint64_t(1) << 63);
+            return rep.long_str.capacity & ~long_flag;
         }
 
-        constexpr void set_long_capacity(Size cap) noexcept {
+        constexpr void set_long_capacity(const std::size_t cap) noexcept {
             BS_VERIFY(is_long(), "string must be in long state when setting capacity");
-            cap |= (uint64_t(1) << 63); // set long string flag
-            rep.long_str.capacity = cap;
+            BS_VERIFY(cap <= max_capacity, "exceeded maximum capacity of the string layout");
+            rep.long_str.capacity = static_cast<Size>(cap) | long_flag; // set long string flag
         }
 
         constexpr Size get_size() const noexcept {
@@ -100,7 +134,7 @@ namespace detail {
             return is_long() ? get_long_capacity() : get_short_capacity();
         }
 
-        constexpr void set_size(const Size size) noexcept {
+        constexpr void set_size(const std::size_t size) noexcept {
             if (is_long()) {
                 set_long_size(size);
             } else {
@@ -139,6 +173,74 @@ namespace detail {
     };
 }
 
+namespace detail {
+    template<class Char>
+    struct char_piece {
+        Char ch;
+
+        constexpr std::size_t size() const noexcept { return 1; }
+        constexpr Char* write(Char* const dest) const noexcept {
+            *dest = ch;
+            return dest + 1;
+        }
+    };
+    template<class Char, class Int>
+    struct integer_piece {
+        detail::formatted_integer<Int> value;
+
+        constexpr std::size_t size() const noexcept { return value.size(); }
+        constexpr Char* write(Char* const dest) const noexcept {
+            return value.write(dest);
+        }
+    };
+    template<class Traits>
+    struct view_piece {
+        bs::string_viewt<Traits> view;
+
+        constexpr std::size_t size() const noexcept { return view.size(); }
+        constexpr typename Traits::char_type* write(typename Traits::char_type* const dest) const noexcept {
+            Traits::copy(dest, view.data(), view.size());
+            return dest + view.size();
+        }
+    };
+
+    template<class Traits, class T>
+    inline constexpr bool is_integer_concat_piece = std::is_integral_v<T>
+        && !std::is_same_v<T, bool> && !bs::is_character<T> && !std::is_same_v<T, typename Traits::char_type>;
+
+    // normalizes an argument of bs::concat to the piece with known length
+    template<class Traits, class T>
+    constexpr auto make_concat_piece(const T& value) noexcept {
+        using char_type = typename Traits::char_type;
+        if constexpr (std::is_same_v<T, char_type>) {
+            return char_piece<char_type>{value};
+        } else if constexpr (is_integer_concat_piece<Traits, T>) {
+            return integer_piece<char_type, T>{detail::formatted_integer<T>{value}};
+        } else {
+            static_assert(std::is_convertible_v<const T&, bs::string_viewt<Traits>>,
+                "concatenated value must be a character, an integer or convertible to the string view");
+            return view_piece<Traits>{bs::string_viewt<Traits>(value)};
+        }
+    }
+
+    template<class... Pieces>
+    constexpr std::size_t concat_pieces_size(const std::tuple<Pieces...>& pieces) noexcept {
+        return std::apply([](const Pieces&... piece) {
+            return (std::size_t(0) + ... + piece.size());
+        }, pieces);
+    }
+    template<class Char, class... Pieces>
+    constexpr Char* concat_pieces_write(Char* dest, const std::tuple<Pieces...>& pieces) noexcept {
+        std::apply([&dest](const Pieces&... piece) {
+            ((dest = piece.write(dest)), ...);
+        }, pieces);
+        return dest;
+    }
+
+    template<class Traits, class... Pieces>
+    class concat_expression;
+}
+
 template<class Traits>
 class stringt {
 public:
@@ -157,10 +259,16 @@ public:
 private:
     static constexpr std::size_t container_alignment = traits_type::string_container_alignment;
 public:
-    using allocator_type = bs::aligned_allocator<value_type, container_alignment>;
+    using allocator_type = typename detail::traits_allocator<
+        traits_type, bs::aligned_allocator<value_type, container_alignment>
+    >::type;
+    using growth_policy = typename detail::traits_growth_policy<traits_type>::type;
+    using string_layout = typename detail::traits_string_layout<traits_type>::type;
 private:
-    // alignas(container_alignment) for small string optimization
-    alignas(container_alignment) detail::string_representation<value_type, size_type, 0> rep;
+    // the standard layout is aligned to container_alignment for small string optimization
+    static constexpr std::size_t representation_alignment = string_layout::alignment != 0 ? string_layout::alignment : container_alignment;
+    using representation = detail::string_representation<value_type, typename string_layout::size_type, string_layout::extra_bytes>;
+    alignas(representation_alignment) representation rep;
 
     using self_string_view = bs::string_viewt<traits_type>;
     using optional_char_reference = std::optional<detail::reference_wrapper<value_type>>;
@@ -215,7 +323,7 @@ public:
                 return;
             }
 
-            size_type alloc_cap = calculate_capacity(count);
+            size_type alloc_cap = calculate_capacity(count + 1);
             pointer alloc_data = allocate(alloc_cap);
             traits_type::copy(alloc_data, rep.get_short_pointer(), count);
             traits_type::assign(alloc_data[count], *first);
@@ -223,17 +331,17 @@ public:
             ++count;
 
             while (first != last) {
-                traits_type::assign(alloc_data[count], *first);
-
-                ++count;
-                if (count >= alloc_cap) {
-                    const size_type new_cap = calculate_capacity(count);
+                if (count == alloc_cap) {
+                    const size_type new_cap = calculate_capacity(count + 1);
                     const pointer new_data = allocate(new_cap);
                     traits_type::copy(new_data, alloc_data, alloc_cap);
                     deallocate(alloc_data, alloc_cap);
                     alloc_data = new_data;
                     alloc_cap = new_cap;
                 }
+                traits_type::assign(alloc_data[count], *first);
+
+                ++count;
                 ++first;
             }
             rep.set_long_state();
@@ -358,6 +466,26 @@ public:
         reserve_exact(size() + additional_cap);
     }
 
+    constexpr void shrink_to_fit() {
+        if (!rep.is_long()) { return; }
+        const size_type long_size = rep.get_long_size();
+        const size_type long_cap = rep.get_long_capacity();
+        if (long_size == long_cap) { return; }
+
+        const pointer old_data = rep.get_long_pointer();
+        if (rep.fits_in_sso(long_size)) {
+            rep.set_short_state();
+            traits_type::copy(rep.get_short_pointer(), old_data, long_size);
+            rep.set_short_size(long_size);
+        } else {
+            const pointer new_data = allocate(long_size);
+            traits_type::copy(new_data, old_data, long_size);
+            rep.set_long_pointer(new_data);
+            rep.set_long_capacity(long_size);
+        }
+        deallocate(old_data, long_cap);
+    }
+
     constexpr void clear() noexcept {
         rep.set_size(0);
     }
@@ -433,13 +561,97 @@ public:
         this->append(detail::to_address(first), static_cast<size_type>(last - first));
     }
 
+    // Appends every piece (string views, characters and integers) with at most one reallocation.
+    template<class... Pieces>
+    constexpr void append_all(const Pieces&... pieces) {
+        append_concat_pieces(std::tuple{detail::make_concat_piece<traits_type>(pieces)...});
+    }
+
+    constexpr stringt& operator+=(const self_string_view str_view) {
+        this->append(str_view);
+        return *this;
+    }
+    constexpr stringt& operator+=(const value_type ch) {
+        this->push_back(ch);
+        return *this;
+    }
+    // Appends the result of `a + b + ...` with at most one reallocation.
+    template<class... Pieces>
+    constexpr stringt& operator+=(const detail::concat_expression<traits_type, Pieces...>& expr) {
+        append_concat_pieces(expr.pieces());
+        return *this;
+    }
+
+    constexpr void insert(const size_type position, const self_string_view str_view) {
+        replace_range(position, 0, str_view.data(), str_view.size());
+    }
+    constexpr void insert(const size_type position, const value_type ch) {
+        replace_range(position, 0, &ch, 1);
+    }
+
+    constexpr void erase(const size_type position) noexcept {
+        BS_VERIFY(position <= size(), "the erase position exceeds the length of the string");
+        rep.set_size(position);
+    }
+    constexpr void erase(const size_type position, const size_type count) noexcept {
+        BS_VERIFY(position <= size(), "the erase position exceeds the length of the string");
+        BS_VERIFY(count <= size() - position, "the erased range exceeds the length of the string");
+        const pointer str = data();
+        const size_type old_size = size();
+        traits_type::move(str + position, str + position + count, old_size - position - count);
+        rep.set_size(old_size - count);
+    }
+
+    // Replaces [position, position + count) with `str_view`, which may refer to the string itself.
+    constexpr void replace(const size_type position, const size_type count, const self_string_view str_view) {
+        replace_range(position, count, str_view.data(), str_view.size());
+    }
+
+    constexpr void resize(const size_type count) {
+        resize(count, value_type());
+    }
+    constexpr void resize(const size_type count, const value_type ch) {
+        const size_type old_size = size();
+        if (count > old_size) {
+            reserve(count);
+            traits_type::assign(data() + old_size, count - old_size, ch);
+        }
+        rep.set_size(count);
+    }
+
+    constexpr void remove_prefix_inplace(const size_type count) noexcept {
+        BS_VERIFY(count <= size(), "the removed prefix exceeds the length of the string");
+        erase(0, count);
+    }
+
+    // Resizes the string to at most `count` characters, letting `op` write directly into the buffer.
+    // `op(data(), count)` must return the new size of the string, that is not greater than `count`.
+    template<class Operation>
+    constexpr void resize_and_overwrite(const size_type count, Operation op) {
+        reserve(count);
+        const auto new_size = std::move(op)(data(), count);
+        BS_VERIFY(detail::cmp_greater_equal(new_size, 0) && detail::cmp_less_equal(new_size, count), "the operation returned size outside the range [0, count]");
+        rep.set_size(static_cast<size_type>(new_size));
+    }
+
+    // Returns a pointer to `count` writable characters past the end of the string.
+    // The characters become part of the string only after commit().
+    [[nodiscard]] constexpr pointer append_uninitialized(const size_type count) BS_LIFETIMEBOUND {
+        reserve(size() + count);
+        return data() + size();
+    }
+    constexpr void commit(const size_type count) noexcept {
+        BS_VERIFY(count <= capacity() - size(), "committed more characters than were reserved");
+        rep.set_size(size() + count);
+    }
+
     constexpr self_string_view substr(const size_type position) const noexcept BS_LIFETIMEBOUND {
         BS_VERIFY(position <= size(), "the start position of the substring exceeds the length of the string");
         return self_string_view{data() + position, size() - position};
     }
     constexpr self_string_view substr(const size_type position, const size_type count) const noexcept BS_LIFETIMEBOUND {
         BS_VERIFY(position <= size(), "the start position of the substring exceeds the length of the string");
-        BS_VERIFY(count - position <= size(), "the length of substring exceeds the length of the string");
+        BS_VERIFY(count <= size() - position, "the length of substring exceeds the length of the string");
         return self_string_view{data() + position, count};
     }
 
@@ -481,6 +693,10 @@ public:
     constexpr size_type capacity() const noexcept {
         return rep.get_capacity();
     }
+    // the largest length of the string allowed by its layout
+    static constexpr size_type max_size() noexcept {
+        return static_cast<size_type>(representation::max_capacity);
+    }
 
     constexpr iterator begin() noexcept BS_LIFETIMEBOUND { return data(); }
     constexpr const_iterator begin() const noexcept BS_LIFETIMEBOUND { return data(); }
@@ -553,6 +769,89 @@ public:
     }
 
 private:
+    template<class... Pieces>
+    constexpr void append_concat_pieces(const std::tuple<Pieces...>& pieces) {
+        const size_type old_size = size();
+        const size_type new_size = old_size + static_cast<size_type>(detail::concat_pieces_size(pieces));
+        if (new_size <= capacity()) {
+            detail::concat_pieces_write(data() + old_size, pieces);
+            rep.set_size(new_size);
+            return;
+        }
+        // the pieces may refer to the current buffer, so it is freed after writing them
+        const size_type new_cap = calculate_capacity(new_size);
+        const pointer new_data = allocate(new_cap);
+        traits_type::copy(new_data, data(), old_size);
+        detail::concat_pieces_write(new_data + old_size, pieces);
+        if (rep.is_long()) {
+            deallocate(rep.get_long_pointer(), rep.get_long_capacity());
+        } else {
+            rep.set_long_state();
+        }
+        rep.set_long_pointer(new_data);
+        rep.set_long_capacity(new_cap);
+        rep.set_long_size(new_size);
+    }
+
+    constexpr bool is_inside_buffer(const const_pointer ptr) const noexcept {
+        const const_pointer begin = data();
+        return std::less_equal<const_pointer>{}(begin, ptr) && std::less<const_pointer>{}(ptr, begin + size());
+    }
+
+    // the characters after the replaced range are moved at most once,
+    // growth reallocates once and copies the three parts directly into the new buffer
+    constexpr void replace_range(const size_type position, const size_type count, const const_pointer src, const size_type src_len) {
+        const size_type old_size = size();
+        BS_VERIFY(position <= old_size, "the position exceeds the length of the string");
+        BS_VERIFY(count <= old_size - position, "the replaced range exceeds the length of the string");
+        const size_type tail_pos = position + count;
+        const size_type tail_len = old_size - tail_pos;
+        const size_type new_size = old_size - count + src_len;
+
+        if (new_size > capacity()) {
+            const size_type new_cap = calculate_capacity(new_size);
+            const pointer new_data = allocate(new_cap);
+            const const_pointer old_data = data();
+            traits_type::copy(new_data, old_data, position);
+            traits_type::copy(new_data + position, src, src_len);
+            traits_type::copy(new_data + position + src_len, old_data + tail_pos, tail_len);
+            // `src` may point into the old buffer, so it is freed after copying
+            if (rep.is_long()) {
+                deallocate(rep.get_long_pointer(), rep.get_long_capacity());
+            } else {
+                rep.set_long_state();
+            }
+            rep.set_long_pointer(new_data);
+            rep.set_long_capacity(new_cap);
+            rep.set_long_size(new_size);
+            return;
+        }
+
+        const pointer str = data();
+        if (src_len <= count || !is_inside_buffer(src)) {
+            // the source is either outside or is not shifted by the tail move
+            // when the replaced range is not shorter than the source
+            if (src_len <= count) {
+                traits_type::move(str + position, src, src_len);
+                traits_type::move(str + position + src_len, str + tail_pos, tail_len);
+            } else {
+                traits_type::move(str + position + src_len, str + tail_pos, tail_len);
+                traits_type::copy(str + position, src, src_len);
+            }
+        } else {
+            // the source is inside the string and the tail is moved to the right by `shift`:
+            // the part of the source before the tail stays in place, the rest is shifted
+            const size_type shift = src_len - count;
+            const size_type src_index = static_cast<size_type>(src - str);
+            traits_type::move(str + position + src_len, str + tail_pos, tail_len);
+            const size_type before_tail = src_index < tail_pos ? tail_pos - src_index : 0;
+            const size_type unshifted = before_tail < src_len ? before_tail : src_len;
+            traits_type::move(str + position, str + src_index, unshifted);
+            traits_type::copy(str + position + unshifted, str + src_index + unshifted + shift, src_len - unshifted);
+        }
+        rep.set_size(new_size);
+    }
+
     using alloc_traits = std::allocator_traits<allocator_type>;
 
     BS_FORCEINLINE BS_FLATTEN
@@ -561,10 +860,10 @@ private:
             rep.set_short_state();
             rep.set_short_size(count);
         } else {
+            // the size is known up front, so the buffer is allocated exactly
             rep.set_long_state();
-            const size_type cap = calculate_capacity(count);
-            rep.set_long_pointer(allocate(cap));
-            rep.set_long_capacity(cap);
+            rep.set_long_pointer(allocate(count));
+            rep.set_long_capacity(count);
             rep.set_long_size(count);
         }
     }
@@ -596,7 +895,7 @@ private:
             rep.set_long_size(buf_len);
         } else {
             deallocate(rep.get_long_pointer(), cap);
-            const size_type new_cap = calculate_capacity(cap);
+            const size_type new_cap = calculate_capacity(buf_len);
             const pointer new_data = allocate(new_cap);
             traits_type::copy(new_data, buf, buf_len);
             rep.set_long_pointer(new_data);
@@ -630,11 +929,10 @@ private:
     }
 
     static constexpr size_type calculate_capacity(const size_type req_cap) noexcept {
-        BS_VERIFY(req_cap != size_type(-1), "exceeded maximum allowed capacity");
-        const size_type new_cap = req_cap * 2;
-        // if overflows
-        if (new_cap < req_cap) { return size_type(-1); }
-        return new_cap;
+        BS_VERIFY(req_cap <= max_size(), "exceeded maximum allowed capacity");
+        const size_type new_cap = growth_policy::capacity(req_cap);
+        BS_VERIFY(new_cap >= req_cap, "growth policy returned capacity less than required");
+        return new_cap < max_size() ? new_cap : max_size();
     }
     [[nodiscard]] constexpr pointer allocate(const size_type cap) noexcept {
         static_assert(alloc_traits::is_always_equal::value);
@@ -681,9 +979,117 @@ constexpr bool operator!=(const typename Tr::char_type(&left)[N], const stringt<
     return !(left == right);
 }
 
+namespace detail {
+    template<class Traits, class... Pieces>
+    BS_CONSTEXPR_CXX20 stringt<Traits> materialize_concat_pieces(const std::tuple<Pieces...>& pieces) {
+        using size_type = typename stringt<Traits>::size_type;
+        using pointer = typename stringt<Traits>::pointer;
+
+        const size_type total_size = static_cast<size_type>(detail::concat_pieces_size(pieces));
+
+        stringt<Traits> out = stringt<Traits>::with_capacity(total_size);
+        out.resize_and_overwrite(total_size, [&pieces](const pointer dest, const size_type count) {
+            detail::concat_pieces_write(dest, pieces);
+            return count;
+        });
+        return out;
+    }
+
+    // Result of `operator+`: references to the operands, that are copied into a string
+    // only when the expression is converted to bs::stringt or appended with `operator+=`.
+    // The expression must not outlive its operands.
+    template<class Traits, class... Pieces>
+    class concat_expression {
+    public:
+        using traits_type = Traits;
+        using size_type = typename Traits::size_type;
+
+        constexpr explicit concat_expression(std::tuple<Pieces...> pieces) noexcept
+            : expr_pieces(std::move(pieces)) {}
+
+        constexpr size_type size() const noexcept {
+            return static_cast<size_type>(detail::concat_pieces_size(expr_pieces));
+        }
+        constexpr const std::tuple<Pieces...>& pieces() const noexcept {
+            return expr_pieces;
+        }
+
+        BS_CONSTEXPR_CXX20 operator stringt<Traits>() const {
+            return detail::materialize_concat_pieces<Traits>(expr_pieces);
+        }
+
+    private:
+        std::tuple<Pieces...> expr_pieces;
+    };
+
+    template<class T>
+    struct concat_operand_traits { using type = void; };
+    template<class Tr>
+    struct concat_operand_traits<stringt<Tr>> { using type = Tr; };
+    template<class Tr>
+    struct concat_operand_traits<string_viewt<Tr>> { using type = Tr; };
+    template<class Tr, class... Pieces>
+    struct concat_operand_traits<concat_expression<Tr, Pieces...>> { using type = Tr; };
+
+    template<class T>
+    inline constexpr bool is_concat_expression = false;
+    template<class Tr, class... Pieces>
+    inline constexpr bool is_concat_expression<concat_expression<Tr, Pieces...>> = true;
+
+    template<class Traits, class T>
+    constexpr bool is_concat_operand() noexcept {
+        if constexpr (std::is_void_v<Traits>) {
+            return false;
+        } else {
+            return std::is_same_v<T, typename Traits::char_type>
+                || is_concat_expression<T>
+                || std::is_convertible_v<const T&, bs::string_viewt<Traits>>;
+        }
+    }
+
+    // at least one operand must be a string, a string view or an expression,
+    // the traits of operands must match
+    template<class Left, class Right>
+    struct concat_operation {
+        using left_traits = typename concat_operand_traits<Left>::type;
+        using right_traits = typename concat_operand_traits<Right>::type;
+        using traits_type = std::conditional_t<std::is_void_v<left_traits>, right_traits, left_traits>;
+
+        static constexpr bool value = (std::is_void_v<left_traits> || std::is_void_v<right_traits> || std::is_same_v<left_traits, right_traits>)
+            && is_concat_operand<traits_type, Left>() && is_concat_operand<traits_type, Right>();
+    };
+
+    template<class Traits, class T>
+    constexpr auto concat_operand_pieces(const T& operand) noexcept {
+        if constexpr (is_concat_expression<T>) {
+            return operand.pieces();
+        } else {
+            return std::make_tuple(detail::make_concat_piece<Traits>(operand));
+        }
+    }
+    template<class Traits, class... Pieces>
+    constexpr concat_expression<Traits, Pieces...> make_concat_expression(std::tuple<Pieces...> pieces) noexcept {
+        return concat_expression<Traits, Pieces...>(std::move(pieces));
+    }
+}
+
+// Lazy concatenation: builds an expression that is materialized with one allocation.
+template<class Left, class Right, std::enable_if_t<detail::concat_operation<Left, Right>::value, int> = 0>
+constexpr auto operator+(const Left& left, const Right& right) noexcept {
+    using traits = typename detail::concat_operation<Left, Right>::traits_type;
+    return detail::make_concat_expression<traits>(std::tuple_cat(
+        detail::concat_operand_pieces<traits>(left), detail::concat_operand_pieces<traits>(right)));
+}
+
 
 using string = stringt<char_traits<char>>;
 
+// Concatenates string views, characters and integers into a new string using a single allocation.
+template<class Traits = char_traits<char>, class... Pieces>
+BS_CONSTEXPR_CXX20 stringt<Traits> concat(const Pieces&... pieces) {
+    return detail::materialize_concat_pieces<Traits>(std::tuple{detail::make_concat_piece<Traits>(pieces)...});
+}
+
 
 
 inline namespace literals {
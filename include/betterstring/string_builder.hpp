@@ -0,0 +1,305 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <betterstring/string.hpp>
+#include <betterstring/string_view.hpp>
+#include <betterstring/detail/preprocessor.hpp>
+#include <charconv>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace bs {
+
+// Appends into a chain of segments whose capacity grows geometrically, the characters written so far are never copied on growth.
+// The text is copied once by `build`, or passed to the output segment by segment through `segments()`.
+// `clear` keeps the segments for the next text.
+template<class Traits>
+class string_buildert {
+public:
+    using traits_type = Traits;
+    using value_type = typename Traits::char_type;
+    using size_type = typename Traits::size_type;
+    using pointer = value_type*;
+    using string_view_type = bs::string_viewt<Traits>;
+private:
+    // the header of the allocation, the characters follow it
+    struct segment {
+        segment* next;
+        size_type size;
+        size_type capacity;
+    };
+
+    static_assert(alignof(value_type) <= alignof(segment), "the characters must be aligned after the header");
+public:
+    // the capacity of the first segment, the next ones double the total capacity up to `max_segment_capacity`
+    static constexpr size_type min_segment_capacity = (4096 - sizeof(segment)) / sizeof(value_type);
+    static constexpr size_type max_segment_capacity = (std::size_t(1) << 20) / sizeof(value_type);
+
+    // Forward iterator over the non-empty segments, yields their characters as views.
+    class segment_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = string_view_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = string_view_type;
+
+        segment_iterator() noexcept = default;
+
+        string_view_type operator*() const noexcept {
+            return string_view_type(characters(current), current->size);
+        }
+        segment_iterator& operator++() noexcept {
+            current = skip_empty(current->next, end);
+            return *this;
+        }
+        segment_iterator operator++(int) noexcept {
+            segment_iterator copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        friend bool operator==(const segment_iterator& left, const segment_iterator& right) noexcept { return left.current == right.current; }
+        friend bool operator!=(const segment_iterator& left, const segment_iterator& right) noexcept { return left.current != right.current; }
+
+    private:
+        friend class string_buildert;
+
+        segment_iterator(const segment* const first, const segment* const end_) noexcept
+            : current(skip_empty(first, end_)), end(end_) {}
+
+        static const segment* skip_empty(const segment* s, const segment* const end_) noexcept {
+            while (s != end_ && s->size == 0) {
+                s = s->next;
+            }
+            return s;
+        }
+
+        const segment* current = nullptr;
+        const segment* end = nullptr;
+    };
+
+    class segment_range {
+    public:
+        segment_iterator begin() const noexcept { return first; }
+        segment_iterator end() const noexcept { return last; }
+    private:
+        friend class string_buildert;
+        segment_range(const segment_iterator first_, const segment_iterator last_) noexcept
+            : first(first_), last(last_) {}
+        segment_iterator first;
+        segment_iterator last;
+    };
+
+    string_buildert() noexcept = default;
+    // allocates the first segment for `size_hint` characters
+    explicit string_buildert(const size_type size_hint) {
+        reserve_hint(size_hint);
+    }
+
+    string_buildert(const string_buildert&) = delete;
+    string_buildert& operator=(const string_buildert&) = delete;
+
+    string_buildert(string_buildert&& other) noexcept
+        : first(std::exchange(other.first, nullptr)), last(std::exchange(other.last, nullptr)),
+        total_size(std::exchange(other.total_size, 0)), total_capacity(std::exchange(other.total_capacity, 0)) {}
+    string_buildert& operator=(string_buildert&& other) noexcept {
+        string_buildert(std::move(other)).swap(*this);
+        return *this;
+    }
+
+    ~string_buildert() noexcept {
+        release();
+    }
+
+    void swap(string_buildert& other) noexcept {
+        std::swap(first, other.first);
+        std::swap(last, other.last);
+        std::swap(total_size, other.total_size);
+        std::swap(total_capacity, other.total_capacity);
+    }
+
+    size_type size() const noexcept { return total_size; }
+    [[nodiscard]] bool empty() const noexcept { return total_size == 0; }
+    // the characters in all allocated segments
+    size_type capacity() const noexcept { return total_capacity; }
+
+    // Makes the next `count` characters fit into the allocated segments.
+    void reserve_hint(const size_type count) {
+        const size_type free = last == nullptr ? 0 : last->capacity - last->size;
+        if (count <= free) { return; }
+        segment* const current = last;
+        add_segment(count - free, count - free);
+        // the rest of the current segment is filled first
+        if (free != 0) {
+            last = current;
+        }
+    }
+
+    void append(const value_type ch) {
+        if (last == nullptr || last->size == last->capacity) {
+            add_segment(1, 1);
+        }
+        characters(last)[last->size++] = ch;
+        ++total_size;
+    }
+    void append(const value_type* str, size_type count) {
+        while (count != 0) {
+            if (last == nullptr || last->size == last->capacity) {
+                add_segment(1, count);
+            }
+            const size_type free = last->capacity - last->size;
+            const size_type copied = count < free ? count : free;
+            Traits::copy(characters(last) + last->size, str, copied);
+            last->size += copied;
+            total_size += copied;
+            str += copied;
+            count -= copied;
+        }
+    }
+    void append(const string_view_type str) {
+        append(str.data(), str.size());
+    }
+    // Appends the decimal representation of the integer.
+    template<class Int, std::enable_if_t<detail::is_integer_concat_piece<Traits, Int>, int> = 0>
+    void append(const Int value) {
+        append_all(value);
+    }
+    // Appends the shortest representation of the floating-point number which round-trips, as `std::to_chars` does.
+    template<class Float, std::enable_if_t<std::is_floating_point_v<Float>, int> = 0>
+    void append(const Float value) {
+        char buffer[64];
+        const std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        const size_type count = static_cast<size_type>(result.ptr - buffer);
+        value_type* const dest = contiguous(count);
+        for (size_type i = 0; i < count; ++i) {
+            dest[i] = static_cast<value_type>(buffer[i]);
+        }
+        commit(count);
+    }
+
+    // Appends every piece (string views, characters and integers) into one segment.
+    template<class... Pieces>
+    void append_all(const Pieces&... pieces) {
+        const std::tuple all_pieces{detail::make_concat_piece<traits_type>(pieces)...};
+        const size_type count = static_cast<size_type>(detail::concat_pieces_size(all_pieces));
+        detail::concat_pieces_write(contiguous(count), all_pieces);
+        commit(count);
+    }
+
+    string_buildert& operator+=(const string_view_type str) {
+        append(str);
+        return *this;
+    }
+    string_buildert& operator+=(const value_type ch) {
+        append(ch);
+        return *this;
+    }
+
+    segment_range segments() const noexcept {
+        const segment* const end = last == nullptr ? nullptr : last->next;
+        return segment_range(segment_iterator(first, end), segment_iterator(end, end));
+    }
+
+    // Copies the text into a string of the exact size.
+    stringt<Traits> build() const {
+        stringt<Traits> out = stringt<Traits>::with_capacity(total_size);
+        out.resize_and_overwrite(total_size, [this](const pointer dest, const size_type count) {
+            build(dest, count);
+            return count;
+        });
+        return out;
+    }
+    // Copies the text into the buffer of at least `size()` characters, returns the number of copied characters.
+    size_type build(const pointer dest, [[maybe_unused]] const size_type dest_size) const noexcept {
+        BS_VERIFY(dest_size >= total_size, "the buffer is smaller than the built string");
+        pointer out = dest;
+        for (const string_view_type part : segments()) {
+            Traits::copy(out, part.data(), part.size());
+            out += part.size();
+        }
+        return total_size;
+    }
+
+    // Empties the builder, the segments are kept for the next text.
+    void clear() noexcept {
+        for (segment* s = first; s != nullptr; s = s->next) {
+            s->size = 0;
+        }
+        last = first;
+        total_size = 0;
+    }
+    // Empties the builder and frees the segments.
+    void release() noexcept {
+        segment* s = first;
+        while (s != nullptr) {
+            segment* const next = s->next;
+            ::operator delete(static_cast<void*>(s), sizeof(segment) + s->capacity * sizeof(value_type));
+            s = next;
+        }
+        first = nullptr;
+        last = nullptr;
+        total_size = 0;
+        total_capacity = 0;
+    }
+
+private:
+    static value_type* characters(segment* const s) noexcept {
+        return reinterpret_cast<value_type*>(s + 1);
+    }
+    static const value_type* characters(const segment* const s) noexcept {
+        return reinterpret_cast<const value_type*>(s + 1);
+    }
+
+    // Makes the last segment the next one with room for at least `min_count` characters.
+    // The kept segment after the last one is reused, otherwise a new segment for at least `count` characters
+    // is inserted after the last one.
+    BS_NOINLINE void add_segment(const size_type min_count, const size_type count) {
+        segment* const next = last == nullptr ? first : last->next;
+        if (next != nullptr && next->capacity >= min_count) {
+            last = next;
+            return;
+        }
+        size_type cap = total_capacity < min_segment_capacity ? min_segment_capacity : total_capacity;
+        if (cap > max_segment_capacity) { cap = max_segment_capacity; }
+        if (cap < count) { cap = count; }
+
+        void* const memory = ::operator new(sizeof(segment) + cap * sizeof(value_type));
+        segment* const s = ::new(memory) segment{next, 0, cap};
+        if (last == nullptr) {
+            first = s;
+        } else {
+            last->next = s;
+        }
+        last = s;
+        total_capacity += cap;
+    }
+
+    // the free characters at the end of a segment, the rest of the current segment is skipped if it is too small
+    value_type* contiguous(const size_type count) {
+        if (last == nullptr || last->capacity - last->size < count) {
+            add_segment(count, count);
+        }
+        return characters(last) + last->size;
+    }
+    void commit(const size_type count) noexcept {
+        last->size += count;
+        total_size += count;
+    }
+
+    segment* first = nullptr;
+    segment* last = nullptr;
+    size_type total_size = 0;
+    size_type total_capacity = 0;
+};
+
+using string_builder = string_buildert<char_traits<char>>;
+
+}
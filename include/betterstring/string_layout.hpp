@@ -0,0 +1,61 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// String layouts define the object representation of bs::stringt: the type of the size and the capacity,
+// the bytes added to the small string buffer and the alignment of the string object.
+// A layout is selected through the `string_layout` member type of the traits.
+
+namespace bs::layout {
+
+// pointer, size and capacity, the string is aligned to `string_container_alignment` of the traits
+struct standard {
+    using size_type = std::size_t;
+    static constexpr std::size_t extra_bytes = 0;
+    // zero is the alignment of the traits
+    static constexpr std::size_t alignment = 0;
+};
+
+// 16 bytes with 32-bit size and capacity, for memory-dense containers of short strings.
+// The length of the string is at most 2^31 - 1.
+struct compact {
+    using size_type = std::uint32_t;
+    static constexpr std::size_t extra_bytes = 0;
+    static constexpr std::size_t alignment = 16;
+};
+
+// `Bytes` bytes with the small string buffer extended to `Bytes - 1` bytes, for workloads dominated by medium strings
+template<std::size_t Bytes>
+struct extended {
+    static_assert(Bytes >= sizeof(void*) + 2 * sizeof(std::size_t), "the extended string must not be smaller than the standard one");
+    static_assert(Bytes % alignof(void*) == 0, "the size of the extended string must be a multiple of the pointer alignment");
+    static_assert(Bytes <= 128, "the short string size must fit into 7 bits");
+
+    using size_type = std::size_t;
+    static constexpr std::size_t extra_bytes = Bytes - (sizeof(void*) + 2 * sizeof(std::size_t));
+    static constexpr std::size_t alignment = alignof(void*);
+};
+
+// 32 bytes aligned to 32, two strings share a cache line and no string crosses one
+struct cache_line {
+    using size_type = std::size_t;
+    static constexpr std::size_t extra_bytes = 32 - (sizeof(void*) + 2 * sizeof(std::size_t));
+    static constexpr std::size_t alignment = 32;
+};
+
+}
+
+namespace bs::detail {
+    template<class Traits, class = void>
+    struct traits_string_layout { using type = bs::layout::standard; };
+    template<class Traits>
+    struct traits_string_layout<Traits, std::void_t<typename Traits::string_layout>> {
+        using type = typename Traits::string_layout;
+    };
+}
@@ -0,0 +1,587 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <betterstring/string.hpp>
+#include <betterstring/string_view.hpp>
+#include <betterstring/allocators.hpp>
+#include <betterstring/hash.hpp>
+#include <betterstring/type_traits.hpp>
+#include <betterstring/detail/preprocessor.hpp>
+#include <betterstring/detail/bit.hpp>
+#include <betterstring/detail/match_mask.hpp>
+#include <betterstring/detail/reference_wrapper.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace bs {
+
+template<class V, class Traits>
+class string_map;
+
+namespace detail {
+    // control byte of a slot: the 7 low bits of the hash of a full slot, or one of the special values
+    enum class control_byte : std::int8_t {
+        empty = -128,
+        deleted = -2,
+    };
+
+    // one bit per slot of the group
+    using group_mask = std::uint32_t;
+
+    // 16 control bytes probed at once
+    struct control_group {
+        static constexpr std::size_t width = 16;
+
+        explicit control_group(const std::int8_t* const ctrl_) noexcept
+            : ctrl(ctrl_) {}
+
+        BS_FORCEINLINE group_mask match(const std::int8_t h2) const noexcept {
+#if BS_HAS_SSE2
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+            return static_cast<group_mask>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(h2))));
+#else
+            group_mask mask = 0;
+            for (std::size_t i = 0; i < width; ++i) {
+                mask |= static_cast<group_mask>(ctrl[i] == h2) << i;
+            }
+            return mask;
+#endif
+        }
+        BS_FORCEINLINE group_mask match_empty() const noexcept {
+            return match(static_cast<std::int8_t>(control_byte::empty));
+        }
+        // the special values are negative
+        BS_FORCEINLINE group_mask match_empty_or_deleted() const noexcept {
+#if BS_HAS_SSE2
+            const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+            return static_cast<group_mask>(_mm_movemask_epi8(bytes));
+#else
+            group_mask mask = 0;
+            for (std::size_t i = 0; i < width; ++i) {
+                mask |= static_cast<group_mask>(ctrl[i] < 0) << i;
+            }
+            return mask;
+#endif
+        }
+
+        const std::int8_t* ctrl;
+    };
+
+    template<class Traits>
+    using string_map_key = detail::string_representation<typename Traits::char_type, typename Traits::size_type, 0>;
+
+    template<class Traits>
+    BS_FORCEINLINE
+    bs::string_viewt<Traits> string_map_key_view(const string_map_key<Traits>& key) noexcept {
+        return bs::string_viewt<Traits>(key.get_pointer(), key.get_size());
+    }
+
+    template<class Map, bool Const>
+    class string_map_iterator {
+        using slot_type = typename Map::slot_type;
+        using mapped_reference = std::conditional_t<Const, const typename Map::mapped_type&, typename Map::mapped_type&>;
+    public:
+        // iterator traits
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::pair<typename Map::key_type, mapped_reference>;
+        using reference = value_type;
+        using iterator_category = std::forward_iterator_tag;
+
+        struct pointer {
+            value_type* operator->() noexcept { return &entry; }
+            value_type entry;
+        };
+
+        constexpr string_map_iterator() noexcept = default;
+        string_map_iterator(const std::int8_t* const ctrl_, slot_type* const slot_) noexcept
+            : ctrl(ctrl_), slot(slot_) {
+            skip_free_slots();
+        }
+        // const iterator from the mutable one
+        template<bool OtherConst, std::enable_if_t<Const && !OtherConst, int> = 0>
+        string_map_iterator(const string_map_iterator<Map, OtherConst>& other) noexcept
+            : ctrl(other.ctrl), slot(other.slot) {}
+
+        reference operator*() const noexcept {
+            return reference(detail::string_map_key_view<typename Map::traits_type>(slot->key), slot->value);
+        }
+        pointer operator->() const noexcept { return pointer{**this}; }
+
+        typename Map::key_type key() const noexcept { return detail::string_map_key_view<typename Map::traits_type>(slot->key); }
+        mapped_reference value() const noexcept { return slot->value; }
+
+        string_map_iterator& operator++() noexcept {
+            ++ctrl;
+            ++slot;
+            skip_free_slots();
+            return *this;
+        }
+        string_map_iterator operator++(int) noexcept {
+            auto tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        friend bool operator==(const string_map_iterator& left, const string_map_iterator& right) noexcept { return left.slot == right.slot; }
+        friend bool operator!=(const string_map_iterator& left, const string_map_iterator& right) noexcept { return left.slot != right.slot; }
+
+    private:
+        template<class, bool>
+        friend class string_map_iterator;
+        template<class, class>
+        friend class bs::string_map;
+
+        // the control bytes end with a full sentinel, see string_map::sentinel
+        void skip_free_slots() noexcept {
+            while (*ctrl < 0) {
+                ++ctrl;
+                ++slot;
+            }
+        }
+
+        const std::int8_t* ctrl = nullptr;
+        slot_type* slot = nullptr;
+    };
+}
+
+// Open addressing hash map from strings to `V` (Swiss table).
+// The slots are probed in groups of 16, the control byte of every slot holds 7 bits of the hash of its key,
+// so the keys are compared only when the fingerprint matches. Keys which fit into the small string buffer
+// (23 chars) are stored in the slot itself, longer keys are copied into the arena owned by the map.
+// The erased long keys stay in the arena until the rehash, which copies the live long keys into a fresh arena;
+// the map rehashes once the erased long keys outweigh the live ones.
+// Lookup takes `string_viewt` and never allocates.
+template<class V, class Traits = char_traits<char>>
+class string_map {
+public:
+    using traits_type = Traits;
+    using key_type = bs::string_viewt<Traits>;
+    using mapped_type = V;
+    using size_type = std::size_t;
+    using iterator = detail::string_map_iterator<string_map, false>;
+    using const_iterator = detail::string_map_iterator<string_map, true>;
+
+    string_map() noexcept = default;
+    explicit string_map(const size_type count) {
+        reserve(count);
+    }
+
+    string_map(const string_map& other)
+        : string_map(other.size()) {
+        for (const auto [key, value] : other) {
+            emplace_new(bs::hash_string<Traits>(key), key, value);
+        }
+    }
+    string_map(string_map&& other) noexcept
+        : ctrl(std::exchange(other.ctrl, nullptr)), slots(std::exchange(other.slots, nullptr))
+        , slot_count(std::exchange(other.slot_count, 0)), element_count(std::exchange(other.element_count, 0))
+        , growth_left(std::exchange(other.growth_left, 0)), keys(std::move(other.keys)) {}
+
+    string_map& operator=(string_map other) noexcept {
+        swap(other);
+        return *this;
+    }
+
+    ~string_map() {
+        destroy();
+    }
+
+    iterator begin() noexcept BS_LIFETIMEBOUND {
+        return slot_count == 0 ? end() : iterator(ctrl, slots);
+    }
+    const_iterator begin() const noexcept BS_LIFETIMEBOUND {
+        return slot_count == 0 ? end() : const_iterator(ctrl, slots);
+    }
+    iterator end() noexcept BS_LIFETIMEBOUND {
+        return iterator(sentinel(), slots + slot_count);
+    }
+    const_iterator end() const noexcept BS_LIFETIMEBOUND {
+        return const_iterator(sentinel(), slots + slot_count);
+    }
+
+    size_type size() const noexcept { return element_count; }
+    [[nodiscard]] bool empty() const noexcept { return element_count == 0; }
+    // the number of slots
+    size_type capacity() const noexcept { return slot_count; }
+    // the bytes of the arena of the long keys
+    size_type key_bytes_reserved() const noexcept { return keys.bytes_reserved(); }
+
+    iterator find(const key_type key) noexcept BS_LIFETIMEBOUND {
+        const std::ptrdiff_t index = find_index(bs::hash_string<Traits>(key), key);
+        return index < 0 ? end() : iterator_at(static_cast<size_type>(index));
+    }
+    const_iterator find(const key_type key) const noexcept BS_LIFETIMEBOUND {
+        const std::ptrdiff_t index = find_index(bs::hash_string<Traits>(key), key);
+        return index < 0 ? end() : const_iterator(iterator_at(static_cast<size_type>(index)));
+    }
+
+    bool contains(const key_type key) const noexcept {
+        return find_index(bs::hash_string<Traits>(key), key) >= 0;
+    }
+    size_type count(const key_type key) const noexcept {
+        return contains(key) ? 1 : 0;
+    }
+
+    std::optional<detail::reference_wrapper<V>> at(const key_type key) noexcept BS_LIFETIMEBOUND {
+        const std::ptrdiff_t index = find_index(bs::hash_string<Traits>(key), key);
+        if (index < 0) { return std::nullopt; }
+        return std::optional<detail::reference_wrapper<V>>(slots[index].value);
+    }
+    std::optional<detail::reference_wrapper<const V>> at(const key_type key) const noexcept BS_LIFETIMEBOUND {
+        const std::ptrdiff_t index = find_index(bs::hash_string<Traits>(key), key);
+        if (index < 0) { return std::nullopt; }
+        return std::optional<detail::reference_wrapper<const V>>(slots[index].value);
+    }
+
+    // Returns the value of the key, inserts the default constructed value if the key is not in the map.
+    V& operator[](const key_type key) BS_LIFETIMEBOUND {
+        return try_emplace(key).first.value();
+    }
+
+    // Inserts the value constructed from `args` if the key is not in the map, otherwise does nothing.
+    // Returns the iterator to the element with the key and whether it was inserted.
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(const key_type key, Args&&... args) BS_LIFETIMEBOUND {
+        const std::uint64_t hash = bs::hash_string<Traits>(key);
+        const std::ptrdiff_t index = find_index(hash, key);
+        if (index >= 0) {
+            return {iterator_at(static_cast<size_type>(index)), false};
+        }
+        return {iterator_at(emplace_new(hash, key, std::forward<Args>(args)...)), true};
+    }
+
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(const key_type key, M&& value) BS_LIFETIMEBOUND {
+        auto result = try_emplace(key, std::forward<M>(value));
+        if (!result.second) {
+            result.first.value() = std::forward<M>(value);
+        }
+        return result;
+    }
+
+    // Removes the key, returns the number of removed elements.
+    size_type erase(const key_type key) noexcept {
+        const std::ptrdiff_t index = find_index(bs::hash_string<Traits>(key), key);
+        if (index < 0) { return 0; }
+        erase_at(static_cast<size_type>(index));
+        return 1;
+    }
+    // Removes the element, returns the iterator to the next element.
+    iterator erase(const const_iterator position) noexcept {
+        const size_type index = static_cast<size_type>(position.slot - slots);
+        erase_at(index);
+        return iterator(ctrl + index + 1, slots + index + 1);
+    }
+
+    // Removes all elements and frees the memory of long keys, the slots are kept.
+    void clear() noexcept {
+        destroy_values();
+        if (slot_count != 0) {
+            reset_control_bytes();
+        }
+        element_count = 0;
+        growth_left = max_load(slot_count);
+        keys.release();
+    }
+
+    // Makes room for `count` elements without rehashing.
+    void reserve(const size_type count) {
+        if (count > max_load(slot_count)) {
+            rehash(slots_for(count));
+        }
+    }
+
+    void swap(string_map& other) noexcept {
+        using std::swap;
+        swap(ctrl, other.ctrl);
+        swap(slots, other.slots);
+        swap(slot_count, other.slot_count);
+        swap(element_count, other.element_count);
+        swap(growth_left, other.growth_left);
+        keys.swap(other.keys);
+    }
+    friend void swap(string_map& left, string_map& right) noexcept { left.swap(right); }
+
+private:
+    template<class, bool>
+    friend class detail::string_map_iterator;
+
+    using key_rep = detail::string_map_key<Traits>;
+
+    struct slot_type {
+        template<class... Args>
+        explicit slot_type(const key_rep& key_, Args&&... args)
+            : key(key_), value(std::forward<Args>(args)...) {}
+
+        key_rep key;
+        V value;
+    };
+
+    // the arena of the long keys, it moves with the map; a copy of the map copies the keys into its own arena
+    struct key_arena {
+        using char_type = typename Traits::char_type;
+
+        key_arena() noexcept = default;
+        key_arena(key_arena&& other) noexcept
+            : arena(std::exchange(other.arena, nullptr))
+            , live_chars(std::exchange(other.live_chars, 0)), dead_chars(std::exchange(other.dead_chars, 0)) {}
+        key_arena& operator=(key_arena&&) = delete;
+        ~key_arena() { delete arena; }
+
+        char_type* allocate(const std::size_t count) {
+            if (arena == nullptr) {
+                arena = new monotonic_arena();
+            }
+            return static_cast<char_type*>(arena->allocate(count * sizeof(char_type), alignof(char_type)));
+        }
+        const char_type* copy(const key_type key) {
+            char_type* const dest = allocate(key.size());
+            Traits::copy(dest, key.data(), key.size());
+            live_chars += key.size();
+            return dest;
+        }
+        // the characters of the erased key stay in the arena until the rehash
+        void discard(const std::size_t count) noexcept {
+            live_chars -= count;
+            dead_chars += count;
+        }
+        // the erased keys outweigh the live ones and fill at least one chunk
+        bool wasteful() const noexcept {
+            return dead_chars > live_chars && dead_chars * sizeof(char_type) >= monotonic_arena::default_chunk_size;
+        }
+        void release() noexcept {
+            if (arena != nullptr) {
+                arena->release();
+            }
+            live_chars = 0;
+            dead_chars = 0;
+        }
+        std::size_t bytes_reserved() const noexcept {
+            return arena == nullptr ? 0 : arena->bytes_reserved();
+        }
+        void swap(key_arena& other) noexcept {
+            std::swap(arena, other.arena);
+            std::swap(live_chars, other.live_chars);
+            std::swap(dead_chars, other.dead_chars);
+        }
+
+        monotonic_arena* arena = nullptr;
+        std::size_t live_chars = 0;
+        std::size_t dead_chars = 0;
+    };
+
+    static constexpr size_type group_width = detail::control_group::width;
+    static constexpr std::int8_t empty_byte = static_cast<std::int8_t>(detail::control_byte::empty);
+    static constexpr std::int8_t deleted_byte = static_cast<std::int8_t>(detail::control_byte::deleted);
+
+    static constexpr size_type max_load(const size_type slot_count_) noexcept {
+        return slot_count_ - slot_count_ / 8;
+    }
+    static size_type slots_for(const size_type count) noexcept {
+        size_type slots_ = group_width;
+        while (max_load(slots_) < count) {
+            slots_ *= 2;
+        }
+        return slots_;
+    }
+
+    static std::int8_t fingerprint(const std::uint64_t hash) noexcept {
+        return static_cast<std::int8_t>(hash & 0x7F);
+    }
+
+    // the full control byte after the last slot stops the iteration
+    const std::int8_t* sentinel() const noexcept {
+        static constexpr std::int8_t end_byte = 0;
+        return slot_count == 0 ? &end_byte : ctrl + slot_count;
+    }
+
+    iterator iterator_at(const size_type index) const noexcept {
+        if (index == slot_count) {
+            return iterator(sentinel(), slots + slot_count);
+        }
+        return iterator(ctrl + index, slots + index);
+    }
+
+    // the groups are probed in the triangular sequence, which visits every group when their number is a power of two
+    std::ptrdiff_t find_index(const std::uint64_t hash, const key_type key) const noexcept {
+        if (slot_count == 0) { return -1; }
+        const std::int8_t h2 = fingerprint(hash);
+        const size_type group_mask_ = slot_count / group_width - 1;
+        size_type group = static_cast<size_type>(hash >> 7) & group_mask_;
+        for (size_type step = 1; ; ++step) {
+            const detail::control_group control(ctrl + group * group_width);
+            for (std::uint64_t matches = control.match(h2); matches != 0; matches = detail::clear_lowest_bit(matches)) {
+                const size_type index = group * group_width + static_cast<size_type>(detail::countr_zero(matches));
+                if (detail::string_map_key_view<Traits>(slots[index].key) == key) {
+                    return static_cast<std::ptrdiff_t>(index);
+                }
+            }
+            if (control.match_empty() != 0) { return -1; }
+            group = (group + step) & group_mask_;
+        }
+    }
+
+    size_type find_free_index(const std::uint64_t hash) const noexcept {
+        const size_type group_mask_ = slot_count / group_width - 1;
+        size_type group = static_cast<size_type>(hash >> 7) & group_mask_;
+        for (size_type step = 1; ; ++step) {
+            const std::uint64_t free = detail::control_group(ctrl + group * group_width).match_empty_or_deleted();
+            if (free != 0) {
+                return group * group_width + static_cast<size_type>(detail::countr_zero(free));
+            }
+            group = (group + step) & group_mask_;
+        }
+    }
+
+    // inserts the key which is not in the map
+    template<class... Args>
+    size_type emplace_new(const std::uint64_t hash, const key_type key, Args&&... args) {
+        if (slot_count == 0) {
+            rehash(group_width);
+        } else if (keys.wasteful()) {
+            rehash(slot_count);
+        }
+        size_type index = find_free_index(hash);
+        if (ctrl[index] == empty_byte && growth_left == 0) {
+            // many deleted slots are reused by the rehash into the same number of slots
+            rehash(element_count * 2 < max_load(slot_count) ? slot_count : slot_count * 2);
+            index = find_free_index(hash);
+        }
+
+        key_rep rep{};
+        if (key_rep::fits_in_sso(key.size())) {
+            rep.set_short_state();
+            rep.set_short_size(key.size());
+            Traits::copy(rep.get_short_pointer(), key.data(), key.size());
+        } else {
+            rep.set_long_state();
+            rep.set_long_capacity(key.size());
+            rep.set_long_size(key.size());
+            rep.set_long_pointer(const_cast<typename Traits::char_type*>(keys.copy(key)));
+        }
+        ::new(static_cast<void*>(slots + index)) slot_type(rep, std::forward<Args>(args)...);
+
+        if (ctrl[index] == empty_byte) {
+            --growth_left;
+        }
+        ctrl[index] = fingerprint(hash);
+        ++element_count;
+        return index;
+    }
+
+    void erase_at(const size_type index) noexcept {
+        if (slots[index].key.is_long()) {
+            keys.discard(slots[index].key.get_long_size());
+        }
+        slots[index].~slot_type();
+        --element_count;
+        // the probing stops at a group with an empty slot, so the slot can be empty only if the group already had one
+        const size_type group = index / group_width * group_width;
+        if (detail::control_group(ctrl + group).match_empty() != 0) {
+            ctrl[index] = empty_byte;
+            ++growth_left;
+        } else {
+            ctrl[index] = deleted_byte;
+        }
+    }
+
+    // When some long keys were erased, the live long keys are copied into a fresh arena and the old one is freed.
+    // Both the slots and the compacted keys are allocated before the first slot is moved.
+    BS_NOINLINE void rehash(const size_type new_slot_count) {
+        std::int8_t* const old_ctrl = ctrl;
+        slot_type* const old_slots = slots;
+        const size_type old_slot_count = slot_count;
+
+        const bool compact = keys.dead_chars != 0;
+        key_arena compacted;
+        typename Traits::char_type* key_cursor = nullptr;
+        if (compact && keys.live_chars != 0) {
+            key_cursor = compacted.allocate(keys.live_chars);
+            compacted.live_chars = keys.live_chars;
+        }
+
+        allocate(new_slot_count);
+        growth_left = max_load(slot_count) - element_count;
+        for (size_type i = 0; i < old_slot_count; ++i) {
+            if (old_ctrl[i] < 0) { continue; }
+            slot_type& old_slot = old_slots[i];
+            key_rep key = old_slot.key;
+            if (compact && key.is_long()) {
+                Traits::copy(key_cursor, key.get_long_pointer(), key.get_long_size());
+                key.set_long_pointer(key_cursor);
+                key_cursor += key.get_long_size();
+            }
+            const std::uint64_t hash = bs::hash_string<Traits>(detail::string_map_key_view<Traits>(key));
+            const size_type index = find_free_index(hash);
+            ::new(static_cast<void*>(slots + index)) slot_type(key, std::move(old_slot.value));
+            old_slot.~slot_type();
+            ctrl[index] = fingerprint(hash);
+        }
+        if (old_slot_count != 0) {
+            deallocate(old_ctrl, old_slot_count);
+        }
+        if (compact) {
+            // the old arena is freed by `compacted`
+            keys.swap(compacted);
+        }
+    }
+
+    static constexpr std::size_t slots_offset(const size_type slot_count_) noexcept {
+        return (slot_count_ + 1 + alignof(slot_type) - 1) / alignof(slot_type) * alignof(slot_type);
+    }
+    static constexpr std::size_t allocation_alignment = alignof(slot_type) > group_width ? alignof(slot_type) : group_width;
+
+    // the control bytes and the slots are one allocation
+    void allocate(const size_type new_slot_count) {
+        const std::size_t bytes = slots_offset(new_slot_count) + new_slot_count * sizeof(slot_type);
+        void* const memory = ::operator new(bytes, std::align_val_t{allocation_alignment});
+        ctrl = static_cast<std::int8_t*>(memory);
+        slots = reinterpret_cast<slot_type*>(static_cast<char*>(memory) + slots_offset(new_slot_count));
+        slot_count = new_slot_count;
+        reset_control_bytes();
+    }
+    static void deallocate(std::int8_t* const ctrl_, const size_type slot_count_) noexcept {
+        const std::size_t bytes = slots_offset(slot_count_) + slot_count_ * sizeof(slot_type);
+        ::operator delete(ctrl_, bytes, std::align_val_t{allocation_alignment});
+    }
+
+    void reset_control_bytes() noexcept {
+        std::memset(ctrl, static_cast<unsigned char>(empty_byte), slot_count);
+        ctrl[slot_count] = 0;
+    }
+
+    void destroy_values() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<V>) {
+            for (size_type i = 0; i < slot_count; ++i) {
+                if (ctrl[i] >= 0) {
+                    slots[i].~slot_type();
+                }
+            }
+        }
+    }
+
+    void destroy() noexcept {
+        if (slot_count != 0) {
+            destroy_values();
+            deallocate(ctrl, slot_count);
+        }
+    }
+
+    std::int8_t* ctrl = nullptr;
+    slot_type* slots = nullptr;
+    size_type slot_count = 0;
+    size_type element_count = 0;
+    size_type growth_left = 0;
+    key_arena keys;
+};
+
+}
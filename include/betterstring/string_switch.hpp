@@ -0,0 +1,255 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <betterstring/string_view.hpp>
+#include <betterstring/functions.hpp>
+#include <betterstring/hash.hpp>
+#include <betterstring/detail/preprocessor.hpp>
+#include <betterstring/detail/bit.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+namespace bs {
+
+namespace detail {
+    // character of the key used by the perfect hash, counted from the front or from the back of the key
+    struct switch_position {
+        std::uint8_t offset;
+        bool from_back;
+    };
+
+    inline constexpr std::size_t max_switch_positions = 4;
+    // the positions are searched among the first and the last characters of the keys
+    inline constexpr std::size_t max_switch_offset = 64;
+
+    inline constexpr std::uint64_t switch_position_factors[max_switch_positions + 1] = {
+        0x9e3779b97f4a7c15, 0xbf58476d1ce4e5b9, 0x94d049bb133111eb, 0xd6e8feb86659fd93, 0xa0761d6478bd642f
+    };
+
+    template<class Traits>
+    constexpr std::uint64_t switch_key(const bs::string_viewt<Traits> str, const switch_position* const positions, const std::size_t position_count) noexcept {
+        using unsigned_char = std::make_unsigned_t<typename Traits::char_type>;
+        const std::size_t size = str.size();
+        std::uint64_t key = static_cast<std::uint64_t>(size) * switch_position_factors[0];
+        for (std::size_t i = 0; i < position_count; ++i) {
+            const std::size_t offset = positions[i].offset;
+            if (offset < size) {
+                const auto ch = str.data()[positions[i].from_back ? size - 1 - offset : offset];
+                key += static_cast<std::uint64_t>(static_cast<unsigned_char>(ch)) * switch_position_factors[i + 1];
+            }
+        }
+        return key;
+    }
+
+    // the number of distinct values in `values`, `seen` has at least `2 * count` power of two elements
+    constexpr std::size_t count_distinct(const std::uint64_t* const values, const std::size_t count, std::uint64_t* const seen, bool* const used, const std::size_t table_size) noexcept {
+        for (std::size_t i = 0; i < table_size; ++i) {
+            used[i] = false;
+        }
+        std::size_t distinct = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            std::size_t slot = static_cast<std::size_t>((values[i] * 0x9e3779b97f4a7c15) >> 32) & (table_size - 1);
+            while (used[slot] && seen[slot] != values[i]) {
+                slot = (slot + 1) & (table_size - 1);
+            }
+            if (!used[slot]) {
+                used[slot] = true;
+                seen[slot] = values[i];
+                ++distinct;
+            }
+        }
+        return distinct;
+    }
+}
+
+// Maps a fixed set of strings to their indices with a perfect hash built at compile time.
+// The hash combines the length of the string with a few of its characters, chosen so that the keys get different hashes,
+// and a lookup is one hash, one read of the bucket displacement, one table probe and one comparison of the strings.
+// If no such characters are found, the whole string is hashed.
+template<std::size_t N, class Traits = char_traits<char>>
+class string_switcht {
+    static_assert(N != 0, "the switch must have at least one key");
+    static_assert(N < 0xFFFF, "too many keys in the switch");
+public:
+    using traits_type = Traits;
+    using string_view_type = bs::string_viewt<Traits>;
+    using size_type = std::size_t;
+
+    static constexpr size_type npos = static_cast<size_type>(-1);
+    // one bucket and two slots of the table per key, rounded up to a power of two
+    static constexpr size_type bucket_count = std::size_t(detail::bit_ceil(N));
+    static constexpr size_type table_capacity = bucket_count * 2;
+
+    // Builds the perfect hash of the keys, throws `std::logic_error` if the keys are not distinct.
+    explicit constexpr string_switcht(const std::array<string_view_type, N>& keys_)
+        : switch_keys(keys_) {
+        std::uint64_t hashes[N]{};
+        std::uint64_t seen[N * 2 > 2 ? std::size_t(detail::bit_ceil(N * 2)) : 2]{};
+        bool used[sizeof(seen) / sizeof(seen[0])]{};
+        const std::size_t seen_size = sizeof(seen) / sizeof(seen[0]);
+
+        std::size_t candidate_count = 0;
+        for (const string_view_type& key : switch_keys) {
+            candidate_count = key.size() > candidate_count ? key.size() : candidate_count;
+        }
+        candidate_count = candidate_count < detail::max_switch_offset ? candidate_count : detail::max_switch_offset;
+
+        // greedily adds the character position which separates the most keys
+        std::size_t distinct = 0;
+        while (true) {
+            for (std::size_t i = 0; i < N; ++i) {
+                hashes[i] = key_of(switch_keys[i]);
+            }
+            distinct = detail::count_distinct(hashes, N, seen, used, seen_size);
+            if (distinct == N || position_count == detail::max_switch_positions) { break; }
+
+            std::size_t best_distinct = distinct;
+            detail::switch_position best{};
+            for (std::size_t candidate = 0; candidate < candidate_count * 2; ++candidate) {
+                positions[position_count] = detail::switch_position{
+                    static_cast<std::uint8_t>(candidate / 2), candidate % 2 == 1
+                };
+                ++position_count;
+                for (std::size_t i = 0; i < N; ++i) {
+                    hashes[i] = key_of(switch_keys[i]);
+                }
+                --position_count;
+                const std::size_t candidate_distinct = detail::count_distinct(hashes, N, seen, used, seen_size);
+                if (candidate_distinct > best_distinct) {
+                    best_distinct = candidate_distinct;
+                    best = positions[position_count];
+                }
+            }
+            if (best_distinct == distinct) { break; }
+            positions[position_count] = best;
+            ++position_count;
+        }
+        if (distinct != N) {
+            whole_string = true;
+            for (std::size_t i = 0; i < N; ++i) {
+                hashes[i] = key_of(switch_keys[i]);
+            }
+            if (detail::count_distinct(hashes, N, seen, used, seen_size) != N) {
+                throw std::logic_error("the keys of the string switch are not distinct");
+            }
+        }
+
+        // Hash and displace: the keys are split into buckets, and the displacement of every bucket is chosen
+        // so that its keys get free slots. The largest buckets are placed first, while most slots are free.
+        std::size_t bucket_head[bucket_count]{};
+        std::size_t next_in_bucket[N]{};
+        std::size_t bucket_size[bucket_count]{};
+        std::size_t largest_bucket = 0;
+        for (std::size_t i = 0; i < N; ++i) {
+            const std::size_t bucket = bucket_of(hashes[i]);
+            next_in_bucket[i] = bucket_head[bucket];
+            bucket_head[bucket] = i + 1;
+            ++bucket_size[bucket];
+            largest_bucket = bucket_size[bucket] > largest_bucket ? bucket_size[bucket] : largest_bucket;
+        }
+        for (std::size_t size = largest_bucket; size != 0; --size) {
+            for (std::size_t bucket = 0; bucket < bucket_count; ++bucket) {
+                if (bucket_size[bucket] == size && !place_bucket(hashes, bucket, bucket_head[bucket], next_in_bucket)) {
+                    throw std::logic_error("no perfect hash of the string switch keys was found");
+                }
+            }
+        }
+    }
+
+    // Returns the index of the key equal to `str`, or `npos` if there is no such key.
+    constexpr size_type find(const string_view_type str) const noexcept {
+        const std::uint16_t entry = table[slot(key_of(str))];
+        if (entry == 0) { return npos; }
+        const string_view_type& key = switch_keys[entry - 1];
+        if (key.size() == str.size() && bs::streq(key.data(), str.data(), str.size())) {
+            return entry - 1;
+        }
+        return npos;
+    }
+
+    // Returns the key index converted to the enumeration, the enumerators must be in the order of the keys.
+    template<class Enum>
+    constexpr std::optional<Enum> find_as(const string_view_type str) const noexcept {
+        static_assert(std::is_enum_v<Enum>, "the result type must be an enumeration");
+        const size_type index = find(str);
+        if (index == npos) { return std::nullopt; }
+        return static_cast<Enum>(index);
+    }
+
+    constexpr bool contains(const string_view_type str) const noexcept { return find(str) != npos; }
+
+    constexpr const std::array<string_view_type, N>& keys() const noexcept { return switch_keys; }
+    static constexpr size_type size() noexcept { return N; }
+    // the number of characters of a string read by the hash besides its length, or `npos` if the whole string is hashed
+    constexpr size_type hashed_positions() const noexcept { return whole_string ? npos : position_count; }
+
+private:
+    constexpr std::uint64_t key_of(const string_view_type str) const noexcept {
+        if (whole_string) {
+            return bs::hash_string<Traits>(str);
+        }
+        return detail::switch_key<Traits>(str, positions, position_count);
+    }
+
+    static constexpr std::size_t bucket_of(const std::uint64_t key) noexcept {
+        return static_cast<std::size_t>((key * 0x9e3779b97f4a7c15) >> 32) & (bucket_count - 1);
+    }
+    static constexpr std::size_t slot_of(const std::uint64_t key, const std::uint16_t displacement) noexcept {
+        std::uint64_t mixed = key + displacement * 0xbf58476d1ce4e5b9;
+        mixed ^= mixed >> 31;
+        mixed *= 0x94d049bb133111eb;
+        mixed ^= mixed >> 29;
+        return static_cast<std::size_t>(mixed) & (table_capacity - 1);
+    }
+    constexpr std::size_t slot(const std::uint64_t key) const noexcept {
+        return slot_of(key, displacements[bucket_of(key)]);
+    }
+
+    // finds the displacement which puts the keys of the bucket into distinct free slots
+    constexpr bool place_bucket(const std::uint64_t* const hashes, const std::size_t bucket, const std::size_t head, const std::size_t* const next_in_bucket) noexcept {
+        for (std::uint32_t displacement = 0; displacement <= 0xFFFF; ++displacement) {
+            const std::uint16_t candidate = static_cast<std::uint16_t>(displacement);
+            std::size_t placed = head;
+            for (; placed != 0; placed = next_in_bucket[placed - 1]) {
+                std::uint16_t& entry = table[slot_of(hashes[placed - 1], candidate)];
+                if (entry != 0) { break; }
+                entry = static_cast<std::uint16_t>(placed);
+            }
+            if (placed == 0) {
+                displacements[bucket] = candidate;
+                return true;
+            }
+            // frees the slots taken by this attempt
+            for (std::size_t i = head; i != placed; i = next_in_bucket[i - 1]) {
+                table[slot_of(hashes[i - 1], candidate)] = 0;
+            }
+        }
+        return false;
+    }
+
+    std::array<string_view_type, N> switch_keys;
+    detail::switch_position positions[detail::max_switch_positions]{};
+    std::size_t position_count = 0;
+    bool whole_string = false;
+    std::array<std::uint16_t, bucket_count> displacements{};
+    // the index of the key plus one, zero is an empty slot
+    std::array<std::uint16_t, table_capacity> table{};
+};
+
+template<std::size_t N>
+using string_switch = string_switcht<N, char_traits<char>>;
+
+// Builds the switch of the keys, `make_string_switch("get"_sv, "set"_sv).find("set"_sv) == 1`.
+template<class Traits = char_traits<char>, class... Keys>
+constexpr string_switcht<sizeof...(Keys), Traits> make_string_switch(const Keys&... keys) {
+    return string_switcht<sizeof...(Keys), Traits>(std::array<bs::string_viewt<Traits>, sizeof...(Keys)>{bs::string_viewt<Traits>(keys)...});
+}
+
+}
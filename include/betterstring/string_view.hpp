@@ -17,6 +17,7 @@
 #include <betterstring/detail/ranges_traits.hpp>
 #include <betterstring/functions.hpp>
 #include <betterstring/splited_string.hpp>
+#include <betterstring/found_positions.hpp>
 #include <betterstring/char_traits.hpp>
 #include <betterstring/type_traits.hpp>
 #include <betterstring/find_result.hpp>
@@ -338,6 +339,21 @@ public:
     constexpr splited_string<string_viewt, value_type> split(const value_type character) const noexcept {
         return splited_string<string_viewt, value_type>(*this, character);
     }
+    constexpr splited_string<string_viewt, string_viewt> split_n(const string_viewt separator, const size_type max_fields) const noexcept {
+        return splited_string<string_viewt, string_viewt>(*this, separator, max_fields);
+    }
+    constexpr splited_string<string_viewt, value_type> split_n(const value_type character, const size_type max_fields) const noexcept {
+        return splited_string<string_viewt, value_type>(*this, character, max_fields);
+    }
+    constexpr splited_string<string_viewt, detail::any_of_separator<string_viewt>> split_any_of(const string_viewt chs) const noexcept {
+        return splited_string<string_viewt, detail::any_of_separator<string_viewt>>(*this, detail::any_of_separator<string_viewt>{chs});
+    }
+    constexpr tokenized_string<string_viewt> split_whitespace() const noexcept {
+        return tokenized_string<string_viewt>(*this, string_viewt(detail::ascii_whitespace<value_type>));
+    }
+    constexpr splited_lines<string_viewt> lines() const noexcept {
+        return splited_lines<string_viewt>(*this);
+    }
     constexpr reverse_splited_string<string_viewt, string_viewt> rsplit(const string_viewt separator) const noexcept {
         return reverse_splited_string<string_viewt, string_viewt>{*this, separator};
     }
@@ -345,6 +361,15 @@ public:
         return reverse_splited_string<string_viewt, value_type>{*this, separator};
     }
 
+    // Lazy range of the positions of every `ch`.
+    constexpr found_positions<string_viewt, value_type> find_all(const value_type ch) const noexcept {
+        return found_positions<string_viewt, value_type>(*this, ch);
+    }
+    // Lazy range of the positions of every non-overlapping occurrence of `str`.
+    constexpr found_positions<string_viewt, string_viewt> find_all(const string_viewt str) const noexcept {
+        return found_positions<string_viewt, string_viewt>(*this, str);
+    }
+
     constexpr size_type count(const value_type ch) const noexcept {
         return traits_type::count(data(), size(), ch);
     }
@@ -482,7 +507,7 @@ using wstring_view = string_viewt<char_traits<wchar_t>>;
 using u16string_view = string_viewt<char_traits<char16_t>>;
 using u32string_view = string_viewt<char_traits<char32_t>>;
 #if BS_HAS_CHAR8_T
-using u8string_view = string_view<char_traits<char8_t>>;
+using u8string_view = string_viewt<char_traits<char8_t>>;
 #endif
 
 inline namespace literals {
@@ -0,0 +1,199 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <betterstring/string.hpp>
+#include <betterstring/string_view.hpp>
+#include <betterstring/type_traits.hpp>
+#include <betterstring/detail/preprocessor.hpp>
+#include <array>
+#include <cstddef>
+
+namespace bs {
+
+namespace detail {
+    template<class Traits>
+    using translation_table = std::array<typename Traits::char_type, 256>;
+
+    template<class Traits>
+    constexpr void replace_chars(typename Traits::char_type* const dest, const typename Traits::char_type* const src, const std::size_t count,
+        const typename Traits::char_type from, const typename Traits::char_type to) noexcept {
+        // branchless select, vectorized by the compiler
+        for (std::size_t i = 0; i < count; ++i) {
+            dest[i] = Traits::eq(src[i], from) ? to : src[i];
+        }
+    }
+
+    template<class Traits>
+    constexpr void translate_chars(typename Traits::char_type* const dest, const typename Traits::char_type* const src, const std::size_t count,
+        const translation_table<Traits>& table) noexcept {
+        static_assert(sizeof(typename Traits::char_type) == 1, "translation table is supported only for single byte characters");
+        for (std::size_t i = 0; i < count; ++i) {
+            dest[i] = table[static_cast<unsigned char>(src[i])];
+        }
+    }
+
+    // counts matches the same way as they are replaced: the search continues after the end of the match
+    template<class Traits>
+    constexpr std::size_t count_replaced(const bs::string_viewt<Traits> str, const bs::string_viewt<Traits> from) noexcept {
+        std::size_t result = 0;
+        const auto* cursor = str.data();
+        const auto* const end = str.data() + str.size();
+        while (true) {
+            cursor = Traits::findstr(cursor, static_cast<std::size_t>(end - cursor), from.data(), from.size());
+            if (cursor == nullptr) { break; }
+            ++result;
+            cursor += from.size();
+        }
+        return result;
+    }
+
+    // copies the characters between the matches with one copy per match,
+    // `find(first, count)` returns the next match or nullptr
+    template<class Traits, class Find>
+    constexpr typename Traits::char_type* write_replaced(typename Traits::char_type* dest, const bs::string_viewt<Traits> str,
+        const std::size_t from_len, const bs::string_viewt<Traits> to, Find find) noexcept {
+        const auto* cursor = str.data();
+        const auto* const end = str.data() + str.size();
+        while (true) {
+            const auto* const match = find(cursor, static_cast<std::size_t>(end - cursor));
+            if (match == nullptr) { break; }
+            const std::size_t prefix_len = static_cast<std::size_t>(match - cursor);
+            Traits::copy(dest, cursor, prefix_len);
+            Traits::copy(dest + prefix_len, to.data(), to.size());
+            dest += prefix_len + to.size();
+            cursor = match + from_len;
+        }
+        Traits::copy(dest, cursor, static_cast<std::size_t>(end - cursor));
+        return dest + (end - cursor);
+    }
+
+    template<class Traits, class Find>
+    BS_CONSTEXPR_CXX20 stringt<Traits> replace_matches(const bs::string_viewt<Traits> str, const std::size_t matches,
+        const std::size_t from_len, const bs::string_viewt<Traits> to, Find find) {
+        using size_type = typename stringt<Traits>::size_type;
+        using pointer = typename stringt<Traits>::pointer;
+
+        const size_type new_size = static_cast<size_type>(str.size() - matches * from_len + matches * to.size());
+        stringt<Traits> out = stringt<Traits>::with_capacity(new_size);
+        out.resize_and_overwrite(new_size, [&](const pointer dest, const size_type count) {
+            if (matches == 0) {
+                Traits::copy(dest, str.data(), str.size());
+            } else {
+                detail::write_replaced<Traits>(dest, str, from_len, to, find);
+            }
+            return count;
+        });
+        return out;
+    }
+}
+
+// Returns a copy of `str` with every character `from` replaced with `to`.
+template<class Traits = char_traits<char>>
+BS_CONSTEXPR_CXX20 stringt<Traits> replace_all(const detail::type_identity_t<bs::string_viewt<Traits>> str,
+    const typename Traits::char_type from, const typename Traits::char_type to) {
+    using size_type = typename stringt<Traits>::size_type;
+    using pointer = typename stringt<Traits>::pointer;
+
+    stringt<Traits> out = stringt<Traits>::with_capacity(str.size());
+    out.resize_and_overwrite(str.size(), [&](const pointer dest, const size_type count) {
+        detail::replace_chars<Traits>(dest, str.data(), count, from, to);
+        return count;
+    });
+    return out;
+}
+
+// Returns a copy of `str` with every character `from` replaced with `to`.
+// The matches are counted first, so the result is allocated once with the exact size.
+template<class Traits = char_traits<char>>
+BS_CONSTEXPR_CXX20 stringt<Traits> replace_all(const detail::type_identity_t<bs::string_viewt<Traits>> str,
+    const typename Traits::char_type from, const detail::type_identity_t<bs::string_viewt<Traits>> to) {
+    using char_type = typename Traits::char_type;
+
+    const std::size_t matches = Traits::count(str.data(), str.size(), from);
+    return detail::replace_matches<Traits>(str, matches, 1, to, [from](const char_type* const first, const std::size_t count) {
+        return Traits::find(first, count, from);
+    });
+}
+
+// Returns a copy of `str` with every non-overlapping occurrence of `from` (searching from the start) replaced with `to`.
+// The matches are counted first, so the result is allocated once with the exact size.
+template<class Traits = char_traits<char>>
+BS_CONSTEXPR_CXX20 stringt<Traits> replace_all(const detail::type_identity_t<bs::string_viewt<Traits>> str,
+    const detail::type_identity_t<bs::string_viewt<Traits>> from, const detail::type_identity_t<bs::string_viewt<Traits>> to) {
+    using char_type = typename Traits::char_type;
+    BS_VERIFY(from.size() != 0, "replaced string is empty");
+
+    const std::size_t matches = detail::count_replaced<Traits>(str, from);
+    return detail::replace_matches<Traits>(str, matches, from.size(), to, [from](const char_type* const first, const std::size_t count) {
+        return Traits::findstr(first, count, from.data(), from.size());
+    });
+}
+
+// Replaces every character `from` with `to` without reallocation.
+template<class Traits>
+constexpr void replace_all_inplace(stringt<Traits>& str, const typename Traits::char_type from, const typename Traits::char_type to) noexcept {
+    detail::replace_chars<Traits>(str.data(), str.data(), str.size(), from, to);
+}
+
+// Replaces every non-overlapping occurrence of `from` with `to` of the same length without reallocation.
+// `to` must not refer to the characters of `str`.
+template<class Traits>
+constexpr void replace_all_inplace(stringt<Traits>& str, const detail::type_identity_t<bs::string_viewt<Traits>> from,
+    const detail::type_identity_t<bs::string_viewt<Traits>> to) noexcept {
+    BS_VERIFY(from.size() != 0, "replaced string is empty");
+    BS_VERIFY(from.size() == to.size(), "in-place replacement must have the same length as the replaced string");
+
+    auto* cursor = str.data();
+    auto* const end = str.data() + str.size();
+    while (true) {
+        const auto* const match = Traits::findstr(cursor, static_cast<std::size_t>(end - cursor), from.data(), from.size());
+        if (match == nullptr) { break; }
+        cursor += (match - cursor);
+        Traits::copy(cursor, to.data(), to.size());
+        cursor += to.size();
+    }
+}
+
+// Returns the table that maps every `from[i]` to `to[i]` and keeps other characters unchanged.
+template<class Traits = char_traits<char>>
+constexpr std::array<typename Traits::char_type, 256> make_translation_table(const detail::type_identity_t<bs::string_viewt<Traits>> from,
+    const detail::type_identity_t<bs::string_viewt<Traits>> to) noexcept {
+    using char_type = typename Traits::char_type;
+    static_assert(sizeof(char_type) == 1, "translation table is supported only for single byte characters");
+    BS_VERIFY(from.size() == to.size(), "translated characters must have the same length as their replacements");
+
+    std::array<char_type, 256> table{};
+    for (std::size_t i = 0; i < table.size(); ++i) {
+        table[i] = static_cast<char_type>(i);
+    }
+    for (std::size_t i = 0; i < from.size(); ++i) {
+        table[static_cast<unsigned char>(from[i])] = to[i];
+    }
+    return table;
+}
+
+// Returns a copy of `str` with every character `ch` replaced with `table[ch]`.
+template<class Traits = char_traits<char>>
+BS_CONSTEXPR_CXX20 stringt<Traits> translate(const detail::type_identity_t<bs::string_viewt<Traits>> str,
+    const std::array<typename Traits::char_type, 256>& table) {
+    using size_type = typename stringt<Traits>::size_type;
+    using pointer = typename stringt<Traits>::pointer;
+
+    stringt<Traits> out = stringt<Traits>::with_capacity(str.size());
+    out.resize_and_overwrite(str.size(), [&](const pointer dest, const size_type count) {
+        detail::translate_chars<Traits>(dest, str.data(), count, table);
+        return count;
+    });
+    return out;
+}
+
+// Replaces every character `ch` with `table[ch]` without reallocation.
+template<class Traits>
+constexpr void translate_inplace(stringt<Traits>& str, const std::array<typename Traits::char_type, 256>& table) noexcept {
+    detail::translate_chars<Traits>(str.data(), str.data(), str.size(), table);
+}
+
+}
@@ -10,6 +10,7 @@
 #include <array>
 
 #include <betterstring/allocators.hpp>
+#include <betterstring/string.hpp>
 
 namespace {
 
@@ -134,5 +135,148 @@ TEST_CASE("aligned_allocator", "[allocators]") {
     }
 }
 
+TEST_CASE("monotonic_arena", "[allocators]") {
+    SECTION("alignment") {
+        bs::monotonic_arena arena;
+        for (std::size_t alignment = 1; alignment <= 256; alignment *= 2) {
+            void* const ptr = arena.allocate(3, alignment);
+            CHECK(std::uintptr_t(ptr) % alignment == 0);
+        }
+    }
+    SECTION("chunk chaining") {
+        bs::monotonic_arena arena{256};
+        std::vector<char*> ptrs;
+        for (std::size_t i = 0; i < 100; ++i) {
+            char* const ptr = static_cast<char*>(arena.allocate(50, 1));
+            std::fill_n(ptr, 50, char(i));
+            ptrs.push_back(ptr);
+        }
+        for (std::size_t i = 0; i < ptrs.size(); ++i) {
+            CHECK(std::all_of(ptrs[i], ptrs[i] + 50, [&](char ch) { return ch == char(i); }));
+        }
+        CHECK(arena.bytes_reserved() >= 100 * 50);
+
+        char* const big = static_cast<char*>(arena.allocate(10000, 16));
+        big[0] = 'a';
+        big[9999] = 'b';
+        CHECK(big[0] == 'a');
+        CHECK(big[9999] == 'b');
+    }
+    SECTION("deallocate last allocation") {
+        bs::monotonic_arena arena;
+        void* const first = arena.allocate(16, 16);
+        arena.deallocate(first, 16, 16);
+        CHECK(arena.allocate(16, 16) == first);
+    }
+    SECTION("release") {
+        bs::monotonic_arena arena;
+        (void)arena.allocate(10000, 8);
+        CHECK(arena.bytes_reserved() > 10000);
+        arena.release();
+        CHECK(arena.bytes_reserved() == 0);
+        (void)arena.allocate(10, 8);
+        CHECK(arena.bytes_reserved() > 0);
+    }
+    SECTION("huge allocation") {
+        bs::monotonic_arena arena;
+        (void)arena.allocate(10, 8);
+        CHECK_THROWS_AS((void)arena.allocate(std::size_t(-1) - 8, 64), std::bad_alloc);
+        CHECK_THROWS_AS((void)arena.allocate(std::size_t(-1) / 2, 1), std::bad_alloc);
+        CHECK(arena.allocate(10, 8) != nullptr);
+    }
+}
+
+TEST_CASE("string_pool", "[allocators]") {
+    SECTION("size classes") {
+        CHECK(bs::string_pool::block_size(1) == 32);
+        CHECK(bs::string_pool::block_size(32) == 32);
+        CHECK(bs::string_pool::block_size(33) == 64);
+        CHECK(bs::string_pool::block_size(1000) == 1024);
+        CHECK(bs::string_pool::block_size(65536) == 65536);
+        CHECK(bs::string_pool::block_size(65537) == 65537);
+    }
+    SECTION("recycling") {
+        bs::string_pool pool;
+        void* const ptr = pool.allocate(100, 32);
+        CHECK(std::uintptr_t(ptr) % 32 == 0);
+        pool.deallocate(ptr, 100, 32);
+        CHECK(pool.cached_count(100) == 1);
+        // any size from the same size class reuses the block
+        CHECK(pool.allocate(120, 32) == ptr);
+        CHECK(pool.cached_count(100) == 0);
+        pool.deallocate(ptr, 120, 32);
+    }
+    SECTION("limit of cached blocks") {
+        bs::string_pool pool{2};
+        void* const ptrs[3] = {pool.allocate(40, 1), pool.allocate(40, 1), pool.allocate(40, 1)};
+        for (void* const ptr : ptrs) {
+            pool.deallocate(ptr, 40, 1);
+        }
+        CHECK(pool.cached_count(40) == 2);
+    }
+    SECTION("large and overaligned blocks") {
+        bs::string_pool pool;
+        void* const large = pool.allocate(100000, 32);
+        pool.deallocate(large, 100000, 32);
+        CHECK(pool.cached_count(100000) == 0);
+
+        void* const overaligned = pool.allocate(64, 256);
+        CHECK(std::uintptr_t(overaligned) % 256 == 0);
+        pool.deallocate(overaligned, 64, 256);
+        CHECK(pool.cached_count(64) == 0);
+    }
 }
 
+template<class Alloc>
+struct allocator_traits_test : bs::char_traits<char> {
+    using allocator_type = Alloc;
+};
+
+struct test_tag {};
+
+TEST_CASE("resource_allocator", "[allocators]") {
+    SECTION("thread_cache_allocator") {
+        bs::thread_cache_allocator<char, 32, test_tag> alloc;
+        char* const ptr = alloc.allocate(500);
+        CHECK(std::uintptr_t(ptr) % 32 == 0);
+        alloc.deallocate(ptr, 500);
+        // freed block is cached by the current thread
+        CHECK(alloc.allocate(500) == ptr);
+        alloc.deallocate(ptr, 500);
+    }
+    SECTION("std::vector") {
+        std::vector<int, bs::pool_allocator<int, 16, test_tag>> vec;
+        for (int i = 0; i < 100; ++i) {
+            vec.push_back(i);
+            CHECK(std::uintptr_t(vec.data()) % 16 == 0);
+        }
+        CHECK(vec[0] == 0);
+        CHECK(vec[99] == 99);
+    }
+    SECTION("bs::stringt") {
+        using monotonic_string = bs::stringt<allocator_traits_test<bs::monotonic_allocator<char, 32, test_tag>>>;
+        using pool_string = bs::stringt<allocator_traits_test<bs::pool_allocator<char, 32, test_tag>>>;
+        using cache_string = bs::stringt<allocator_traits_test<bs::thread_cache_allocator<char, 32, test_tag>>>;
+
+        {
+            monotonic_string str;
+            for (std::size_t i = 0; i < 100; ++i) {
+                str.push_back('x');
+            }
+            CHECK(str.size() == 100);
+            CHECK(std::uintptr_t(str.data()) % 32 == 0);
+        }
+        monotonic_string::allocator_type::resource().release();
+
+        pool_string str1{"long string long string long string", 35};
+        pool_string str2 = str1;
+        str2.append(str1);
+        CHECK(str2 == "long string long string long stringlong string long string long string");
+
+        cache_string str3{"long string long string long string", 35};
+        cache_string str4{str3};
+        CHECK(str4 == "long string long string long string");
+    }
+}
+
+}
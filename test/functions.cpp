@@ -62,6 +62,18 @@ TEST_CASE("bs::strcomp", "[functions]") {
     CHECK(bs::strcomp("test strind", "test string", 11) < 0);
 
     CHECK(bs::strcomp("test string", 11, "test strina", 11) > 0);
+
+    SECTION("constant evaluation matches runtime") {
+        // the characters above 127 compare as unsigned both in constant expressions and at runtime
+        constexpr int constant = bs::strcomp("\x80", "a", 1);
+        static_assert(constant > 0);
+        const char* volatile runtime_left = "\x80";
+        CHECK(bs::strcomp(runtime_left, "a", 1) > 0);
+
+        constexpr int constant_wide = bs::strcomp(L"ab", L"ac", 2);
+        static_assert(constant_wide < 0);
+        CHECK(bs::strcomp(L"ab", L"ac", 2) < 0);
+    }
 }
 
 TEST_CASE("bs::strfind", "[functions]") {
@@ -0,0 +1,104 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <betterstring/hash.hpp>
+
+namespace {
+
+using namespace bs::literals;
+
+TEST_CASE("hash_string", "[hash]") {
+    SECTION("reference values") {
+        // wyhash final version 4 with the default secret
+        CHECK(bs::hash_string(""_sv) == 0x93228a4de0eec5a2);
+        CHECK(bs::hash_string("a"_sv) == 0xaced12527fe5bff8);
+        CHECK(bs::hash_string("message digest"_sv) == 0x309ab4c045215e8f);
+        CHECK(bs::hash_string(""_sv) != bs::hash_string(""_sv, 1));
+        CHECK(bs::hash_string("a"_sv) != bs::hash_string("b"_sv));
+        CHECK(bs::hash_string("ab"_sv) != bs::hash_string("ba"_sv));
+    }
+    SECTION("every length") {
+        std::string text;
+        std::unordered_set<std::uint64_t> hashes;
+        for (std::size_t length = 0; length <= 300; ++length) {
+            const bs::string_view str(text.data(), text.size());
+            CHECK(hashes.insert(bs::hash_string(str)).second);
+            // the result does not depend on the characters outside of the string
+            std::string copy = text + "tail";
+            CHECK(bs::hash_string(bs::string_view(copy.data(), length)) == bs::hash_string(str));
+            text += static_cast<char>('a' + length % 26);
+        }
+        // one changed character changes the hash
+        for (std::size_t i = 0; i < text.size(); ++i) {
+            std::string changed = text;
+            changed[i] = '#';
+            CHECK(bs::hash_string(bs::string_view(changed.data(), changed.size())) != bs::hash_string(bs::string_view(text.data(), text.size())));
+        }
+    }
+    SECTION("constexpr") {
+        constexpr std::uint64_t short_hash = bs::hash_string("key"_sv);
+        constexpr std::uint64_t long_hash = bs::hash_string("a string which is longer than forty eight characters in total"_sv);
+        constexpr std::uint64_t wide_hash = bs::hash_string<bs::char_traits<char16_t>>(u"wide characters");
+        const bs::string_view short_str = "key"_sv;
+        const bs::string_view long_str = "a string which is longer than forty eight characters in total"_sv;
+        CHECK(bs::hash_string(short_str) == short_hash);
+        CHECK(bs::hash_string(long_str) == long_hash);
+        const char16_t wide[] = u"wide characters";
+        CHECK(bs::hash_string<bs::char_traits<char16_t>>(wide) == wide_hash);
+    }
+}
+
+TEST_CASE("hash_string_ascii_icase", "[hash]") {
+    CHECK(bs::hash_string_ascii_icase("Content-Type"_sv) == bs::hash_string("content-type"_sv));
+    CHECK(bs::hash_string_ascii_icase("CONTENT-TYPE"_sv) == bs::hash_string_ascii_icase("content-type"_sv));
+    CHECK(bs::hash_string_ascii_icase("[@`{"_sv) == bs::hash_string("[@`{"_sv));
+
+    std::string text;
+    std::string lowercase;
+    for (std::size_t length = 0; length <= 130; ++length) {
+        CHECK(bs::hash_string_ascii_icase(bs::string_view(text.data(), text.size())) == bs::hash_string(bs::string_view(lowercase.data(), lowercase.size())));
+        const char ch = static_cast<char>(length * 37 % 128);
+        text += ch;
+        lowercase += bs::ascii::to_lowercase(ch);
+    }
+
+    STATIC_CHECK(bs::hash_string_ascii_icase("HeLLo WoRLD"_sv) == bs::hash_string("hello world"_sv));
+    constexpr std::uint64_t wide_hash = bs::hash_string_ascii_icase<bs::char_traits<char32_t>>(U"ABC");
+    const char32_t wide[] = U"aBc";
+    CHECK(bs::hash_string_ascii_icase<bs::char_traits<char32_t>>(wide) == wide_hash);
+}
+
+TEST_CASE("hash function objects", "[hash]") {
+    SECTION("std::hash") {
+        std::unordered_map<bs::string, int> map;
+        map["one"_s] = 1;
+        map["two"_s] = 2;
+        CHECK(map.at("one"_s) == 1);
+        CHECK(std::hash<bs::string>{}("two"_s) == std::hash<bs::string_view>{}("two"_sv));
+
+        std::unordered_set<bs::string_view> set{"a"_sv, "b"_sv};
+        CHECK(set.count("a"_sv) == 1);
+        CHECK(set.count("c"_sv) == 0);
+    }
+    SECTION("case insensitive") {
+        std::unordered_map<bs::string_view, int, bs::ascii_icase_hash<bs::string_view>, bs::ascii_icase_equal_to<bs::string_view>> headers;
+        headers["Content-Length"_sv] = 42;
+        CHECK(headers.count("content-length"_sv) == 1);
+        CHECK(headers.at("CONTENT-LENGTH"_sv) == 42);
+        CHECK(headers.count("content-type"_sv) == 0);
+
+        const bs::ascii_icase_equal_to<bs::string_view> equal;
+        CHECK(equal("Host"_sv, "hOST"_sv));
+        CHECK_FALSE(equal("Host"_sv, "Hosts"_sv));
+        CHECK_FALSE(equal("["_sv, "{"_sv));
+    }
+}
+
+}
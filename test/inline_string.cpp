@@ -0,0 +1,132 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_set>
+
+#include <betterstring/inline_string.hpp>
+
+namespace {
+
+using namespace bs::literals;
+
+static_assert(std::is_trivially_copyable_v<bs::inline_string<31>>);
+static_assert(sizeof(bs::inline_string<31>) == 32);
+static_assert(sizeof(bs::inline_string<62, char16_t>) == 126);
+// no padding bytes, the characters fill them
+static_assert(sizeof(bs::inline_string<3, char16_t>) == 8);
+static_assert(std::has_unique_object_representations_v<bs::inline_string<16>>);
+static_assert(std::has_unique_object_representations_v<bs::inline_string<3, char16_t>>);
+static_assert(std::has_unique_object_representations_v<bs::inline_string<3, char32_t>>);
+static_assert(std::has_unique_object_representations_v<bs::inline_string<257>>);
+static_assert(std::has_unique_object_representations_v<bs::inline_string<70001>>);
+static_assert(std::has_unique_object_representations_v<bs::inline_string<0, char32_t>>);
+
+constexpr bs::inline_string<16> make_name() {
+    bs::inline_string<16> name("user"_sv);
+    name += '_';
+    name.append("id"_sv);
+    name.insert(0, "db."_sv);
+    return name;
+}
+
+#if BS_CXX20
+template<bs::inline_string Name>
+constexpr std::size_t name_size() { return Name.size(); }
+
+template<bs::inline_string<8> Name>
+constexpr bool is_get() { return Name == "GET"_sv; }
+#endif
+
+TEST_CASE("inline_string", "[inline_string]") {
+    SECTION("constexpr") {
+        STATIC_CHECK(make_name() == "db.user_id"_sv);
+        STATIC_CHECK(make_name().size() == 10);
+        STATIC_CHECK(bs::inline_string<8>::filled('x', 3) == "xxx"_sv);
+#if BS_CXX20
+        STATIC_CHECK(name_size<"content-type">() == 12);
+        STATIC_CHECK(is_get<"GET">());
+        STATIC_CHECK(!is_get<"PUT">());
+#endif
+    }
+    SECTION("modification") {
+        bs::inline_string<16> str("hello world"_sv);
+        CHECK(str.capacity() == 16);
+        str.replace(0, 5, "goodbye"_sv);
+        CHECK(str == "goodbye world"_sv);
+        str.erase(7, 6);
+        CHECK(str == "goodbye"_sv);
+        str.insert(4, str.substr(0, 4));
+        CHECK(str == "goodgoodbye"_sv);
+        str.remove_prefix_inplace(4);
+        CHECK(str == "goodbye"_sv);
+        str.resize(9, '!');
+        CHECK(str == "goodbye!!"_sv);
+        str.resize(4);
+        CHECK(str == "good"_sv);
+        str.pop_back();
+        CHECK(str.back() == 'o');
+        CHECK(str[-1] == 'o');
+        CHECK_FALSE(str.at(3).has_value());
+        str.resize_and_overwrite(10, [](char* const data, const std::size_t count) {
+            std::memset(data, 'z', count);
+            return std::size_t(5);
+        });
+        CHECK(str == "zzzzz"_sv);
+        CHECK(str.starts_with('z'));
+        CHECK(str.contains("zz"_sv));
+        str.clear();
+        CHECK(str.empty());
+        // the characters after the end are zero
+        for (const char ch : str.chars) {
+            CHECK(ch == '\0');
+        }
+    }
+    SECTION("equal strings have equal object representations") {
+        bs::inline_string<16> left("a longer string"_sv);
+        left.erase(1);
+        const bs::inline_string<16> right("a"_sv);
+        CHECK(left == right);
+        CHECK(std::memcmp(&left, &right, sizeof(left)) == 0);
+
+        bs::inline_string<3, char16_t> wide_left(u"abc"_sv);
+        wide_left.pop_back();
+        const bs::inline_string<3, char16_t> wide_right(u"ab"_sv);
+        CHECK(wide_left == wide_right);
+        CHECK(std::memcmp(&wide_left, &wide_right, sizeof(wide_left)) == 0);
+    }
+    SECTION("overflow") {
+        bs::inline_string<4> thrown("abc"_sv);
+        CHECK_THROWS_AS(thrown.append("de"_sv), std::length_error);
+        CHECK_THROWS_AS(bs::inline_string<4>("abcde"_sv), std::length_error);
+        CHECK_THROWS_AS(thrown.insert(0, "xy"_sv), std::length_error);
+        thrown.push_back('d');
+        CHECK_THROWS_AS(thrown.push_back('e'), std::length_error);
+        CHECK(thrown == "abcd"_sv);
+
+        bs::inline_string<4, char, bs::overflow_truncate> truncated("abcdef"_sv);
+        CHECK(truncated == "abcd"_sv);
+        truncated.erase(2);
+        truncated.insert(1, "xyz"_sv);
+        CHECK(truncated == "axyz"_sv);
+        truncated.push_back('!');
+        CHECK(truncated == "axyz"_sv);
+        truncated.replace(0, 1, "12"_sv);
+        CHECK(truncated == "12xy"_sv);
+        truncated.resize(10, '-');
+        CHECK(truncated.size() == 4);
+    }
+    SECTION("hash table key") {
+        std::unordered_set<bs::inline_string<32>> keys;
+        keys.insert(bs::inline_string<32>("first"_sv));
+        keys.insert(bs::inline_string<32>("second"_sv));
+        CHECK(keys.count(bs::inline_string<32>("first"_sv)) == 1);
+        CHECK(bs::hash<bs::inline_string<32>>{}(bs::inline_string<32>("key"_sv)) == bs::hash<bs::string_view>{}("key"_sv));
+    }
+}
+
+}
@@ -0,0 +1,97 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include <betterstring/intern_pool.hpp>
+
+namespace {
+
+using namespace bs::literals;
+
+bs::string_view view_of(const std::string& str) noexcept {
+    return bs::string_view(str.data(), str.size());
+}
+
+TEST_CASE("intern_pool", "[intern_pool]") {
+    SECTION("equal strings have equal handles") {
+        bs::intern_pool pool;
+        const bs::intern_handle host = pool.intern("host"_sv);
+        const bs::intern_handle port = pool.intern("port"_sv);
+        CHECK(host != port);
+
+        std::string copy = "host";
+        CHECK(pool.intern(view_of(copy)) == host);
+        CHECK(pool.size() == 2);
+        CHECK(pool.view(host) == "host"_sv);
+        CHECK(pool[port] == "port"_sv);
+        CHECK(pool.find("port"_sv) == port);
+        CHECK_FALSE(pool.find("path"_sv).has_value());
+
+        // the interned view does not point into the argument
+        copy = "changed";
+        CHECK(pool.intern_view("host"_sv).data() == pool.view(host).data());
+        CHECK(pool.intern(""_sv) == pool.intern(""_sv));
+        CHECK(pool.size() == 3);
+    }
+    SECTION("views are stable") {
+        bs::intern_pool pool;
+        std::vector<bs::intern_handle> handles;
+        std::vector<bs::string_view> views;
+        for (int i = 0; i < 20000; ++i) {
+            const std::string name = "field_" + std::to_string(i);
+            handles.push_back(pool.intern(view_of(name)));
+            views.push_back(pool.view(handles.back()));
+        }
+        CHECK(pool.size() == 20000);
+        std::unordered_set<bs::intern_handle> distinct(handles.begin(), handles.end());
+        CHECK(distinct.size() == handles.size());
+        for (int i = 0; i < 20000; ++i) {
+            const std::string name = "field_" + std::to_string(i);
+            CHECK(pool.view(handles[i]).data() == views[i].data());
+            CHECK(views[i] == view_of(name));
+            CHECK(pool.intern(view_of(name)) == handles[i]);
+        }
+        CHECK(pool.bytes_reserved() > 20000 * 10);
+    }
+    SECTION("concurrent interning") {
+        bs::intern_pool pool;
+        const int thread_count = 4;
+        const int name_count = 5000;
+        std::vector<std::vector<bs::intern_handle>> results(thread_count);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < thread_count; ++t) {
+            threads.emplace_back([&, t] {
+                for (int i = 0; i < name_count; ++i) {
+                    // every thread interns the same names in a different order
+                    const int name = (i * (t + 1) * 7 + t) % name_count;
+                    const std::string str = "tag" + std::to_string(name);
+                    const bs::intern_handle handle = pool.intern(view_of(str));
+                    if (pool.view(handle) != view_of(str)) {
+                        results[t].clear();
+                        return;
+                    }
+                    results[t].push_back(handle);
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        CHECK(pool.size() == name_count);
+        for (int t = 0; t < thread_count; ++t) {
+            REQUIRE(results[t].size() == name_count);
+            for (int i = 0; i < name_count; ++i) {
+                const int name = (i * (t + 1) * 7 + t) % name_count;
+                CHECK(results[t][i] == pool.find(view_of("tag" + std::to_string(name))));
+            }
+        }
+    }
+}
+
+}
@@ -0,0 +1,118 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "util.hpp"
+#include <betterstring/io_slices.hpp>
+
+namespace {
+
+using namespace bs::literals;
+
+TEST_CASE("io_slices", "[io_slices]") {
+    SECTION("fragments") {
+        const bs::string owned("owned string, "_sv);
+        bs::string_builder builder;
+        builder.append_all("builder ", 42, ", ");
+        bs::io_slices slices;
+        slices.push_back_all("view, "_sv, owned, ""_sv, builder, "end"_sv);
+        CHECK(slices.size() == 4);
+        CHECK(slices.bytes() == 35);
+        CHECK(slices.data()[1].iov_base == owned.data());
+
+        temporary_file file("io_slices.txt", "", O_WRONLY | O_TRUNC);
+        CHECK(slices.writev(file.fd) == 35);
+        CHECK(slices.empty());
+        CHECK(slices.bytes() == 0);
+        CHECK(file.content() == "view, owned string, builder 42, end");
+    }
+    SECTION("more slices than one batch") {
+        std::vector<std::string> fragments;
+        std::string expected;
+        for (std::size_t i = 0; i < 3 * bs::io_slices::max_batch_slices + 7; ++i) {
+            fragments.push_back(std::to_string(i) + ",");
+            expected += fragments.back();
+        }
+        bs::io_slices slices(fragments.size());
+        for (const std::string& fragment : fragments) {
+            slices.push_back(bs::string_view(fragment.data(), fragment.size()));
+        }
+        temporary_file file("io_slices.txt", "", O_WRONLY | O_TRUNC);
+        CHECK(slices.writev(file.fd) == expected.size());
+        CHECK(file.content() == expected);
+
+        for (const std::string& fragment : fragments) {
+            slices.push_back(bs::string_view(fragment.data(), fragment.size()));
+        }
+        CHECK(slices.pwritev(file.fd, 3) == expected.size());
+        CHECK(file.content() == expected.substr(0, 3) + expected);
+    }
+#ifndef _WIN32
+    SECTION("partial writes to a non-blocking pipe") {
+        // the pipe buffer is smaller than the slices, so the write stops in the middle of a slice
+        const bs::string_view header = "header "_sv;
+        const std::string large(1 << 20, 'x');
+        std::string expected;
+        bs::io_slices slices;
+        for (int i = 0; i < 10; ++i) {
+            slices.push_back(header);
+            slices.push_back(bs::string_view(large.data(), large.size() - static_cast<std::size_t>(i)));
+            expected += "header " + large.substr(static_cast<std::size_t>(i));
+        }
+        int fds[2];
+        REQUIRE(::pipe(fds) == 0);
+        REQUIRE(::fcntl(fds[0], F_SETFL, O_NONBLOCK) == 0);
+        REQUIRE(::fcntl(fds[1], F_SETFL, O_NONBLOCK) == 0);
+        std::string received;
+        const auto drain = [&] {
+            char buffer[4096];
+            while (true) {
+                const auto count = ::read(fds[0], buffer, sizeof(buffer));
+                if (count <= 0) { break; }
+                received.append(buffer, static_cast<std::size_t>(count));
+            }
+        };
+        // returns false if the pipe is full
+        const auto write = [&] {
+            try {
+                slices.writev(fds[1]);
+                return true;
+            } catch (const std::system_error& error) {
+                REQUIRE(error.code() == std::errc::resource_unavailable_try_again);
+                return false;
+            }
+        };
+
+        REQUIRE_FALSE(write());
+        // the unwritten slices start at the first unwritten byte
+        const std::size_t written = expected.size() - slices.bytes();
+        REQUIRE(written != 0);
+        REQUIRE_FALSE(slices.empty());
+        const bs::io_slices::slice_type& next = slices.data()[0];
+        CHECK(std::string_view(static_cast<const char*>(next.iov_base), next.iov_len) == std::string_view(expected).substr(written, next.iov_len));
+        CHECK(next.iov_base != header.data());
+        CHECK(next.iov_base != large.data());
+        drain();
+        CHECK(received == expected.substr(0, written));
+
+        // resumed after the reader makes room
+        while (!write()) {
+            drain();
+        }
+        drain();
+        ::close(fds[1]);
+        ::close(fds[0]);
+        CHECK(slices.empty());
+        CHECK(received.size() == expected.size());
+        CHECK(received == expected);
+    }
+#endif
+}
+
+}
@@ -0,0 +1,65 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+
+#include "util.hpp"
+#include <betterstring/line_reader.hpp>
+
+namespace {
+
+using namespace bs::literals;
+
+std::vector<std::string> read_lines(const std::string& content, const std::size_t buffer_size) {
+    const temporary_file file("line_reader.txt", content, O_RDONLY);
+    REQUIRE(file.fd != -1);
+    bs::line_reader reader(file.fd, buffer_size);
+    std::vector<std::string> lines;
+    for (const bs::string_view line : reader) {
+        lines.emplace_back(line.data(), line.size());
+    }
+    return lines;
+}
+
+TEST_CASE("line_reader", "[line_reader]") {
+    SECTION("lines") {
+        CHECK(read_lines("first\nsecond\r\n\nlast", 1024) == std::vector<std::string>{"first", "second", "", "last"});
+        CHECK(read_lines("line\n", 1024) == std::vector<std::string>{"line"});
+        CHECK(read_lines("\n\n", 1024) == std::vector<std::string>{"", ""});
+        CHECK(read_lines("", 1024).empty());
+    }
+    SECTION("next_line") {
+        const temporary_file file("line_reader.txt", "a\nbc\n", O_RDONLY);
+        bs::line_reader reader(file.fd, 3);
+        CHECK(reader.next_line() == "a"_sv);
+        CHECK(reader.next_line() == "bc"_sv);
+        CHECK_FALSE(reader.next_line().has_value());
+        CHECK_FALSE(reader.next_line().has_value());
+    }
+    SECTION("lines longer than the buffer") {
+        const std::string long_line(1000, 'x');
+        const std::vector<std::string> lines = read_lines("a\n" + long_line + "\nb", 16);
+        CHECK(lines == std::vector<std::string>{"a", long_line, "b"});
+    }
+    SECTION("same lines as lines()") {
+        random_generator rng{7};
+        std::string content;
+        for (std::size_t i = 0; i < 5000; ++i) {
+            const std::size_t value = rng.next(40);
+            content += value == 0 ? '\n' : value == 1 ? '\r' : static_cast<char>('a' + value % 26);
+        }
+        const bs::string_view str(content.data(), content.size());
+        std::vector<std::string> expected;
+        for (const bs::string_view line : str.lines()) {
+            expected.emplace_back(line.data(), line.size());
+        }
+        for (const std::size_t buffer_size : {std::size_t(1), std::size_t(7), std::size_t(64), std::size_t(4096)}) {
+            CHECK(read_lines(content, buffer_size) == expected);
+        }
+    }
+}
+
+}
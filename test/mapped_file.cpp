@@ -0,0 +1,72 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <system_error>
+
+#include "util.hpp"
+#include <betterstring/mapped_file.hpp>
+
+namespace {
+
+using namespace bs::literals;
+
+TEST_CASE("mapped_file", "[mapped_file]") {
+    SECTION("content") {
+        std::string content;
+        for (std::size_t i = 0; i < 10000; ++i) {
+            content += i % 50 == 0 ? '\n' : static_cast<char>('a' + i % 26);
+        }
+        const temporary_file file("mapped_file.txt", content);
+
+        const bs::mapped_file mapped(file.path.c_str());
+        REQUIRE(mapped.size() == content.size());
+        CHECK(mapped.view() == bs::string_view(content.data(), content.size()));
+        CHECK(mapped.view().find('\n').index() == 0);
+        CHECK(mapped.advise(bs::mapped_file::access_hint::sequential));
+        CHECK(mapped.advise(bs::mapped_file::access_hint::normal));
+    }
+    SECTION("empty file") {
+        const temporary_file file("mapped_file.txt", "");
+        const bs::mapped_file mapped(file.path.c_str());
+        CHECK(mapped.empty());
+        CHECK(mapped.view() == ""_sv);
+        CHECK_FALSE(mapped.advise(bs::mapped_file::access_hint::sequential));
+    }
+    SECTION("missing file") {
+        CHECK_THROWS_AS(bs::mapped_file("betterstring/this/file/does/not/exist"), std::system_error);
+    }
+    SECTION("move") {
+        const temporary_file file("mapped_file.txt", "mapped file content");
+        bs::mapped_file mapped(file.path.c_str());
+        bs::mapped_file moved(std::move(mapped));
+        CHECK(mapped.empty());
+        CHECK(moved.view() == "mapped file content"_sv);
+
+        mapped = std::move(moved);
+        CHECK(mapped.view() == "mapped file content"_sv);
+        mapped.close();
+        CHECK(mapped.empty());
+    }
+}
+
+TEST_CASE("for_each_page", "[mapped_file]") {
+    for (const std::size_t length : {std::size_t(0), std::size_t(1), bs::scan_page_size, bs::scan_page_size * 5 + 17}) {
+        const std::string text(length, 'x');
+        const bs::string_view str(text.data(), text.size());
+        for (const std::size_t distance : {std::size_t(0), std::size_t(1), std::size_t(8)}) {
+            std::size_t expected_position = 0;
+            bs::for_each_page(str, [&](const bs::string_view page) {
+                CHECK(page.data() == str.data() + expected_position);
+                CHECK(page.size() <= bs::scan_page_size);
+                CHECK(page.size() != 0);
+                expected_position += page.size();
+            }, distance);
+            CHECK(expected_position == length);
+        }
+    }
+}
+
+}
@@ -0,0 +1,167 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "util.hpp"
+#include <betterstring/parallel.hpp>
+
+namespace {
+
+using namespace bs::literals;
+
+std::vector<std::size_t> sequential_find_all(const bs::string_view str, const bs::string_view needle) {
+    std::vector<std::size_t> positions;
+    for (const std::size_t position : str.find_all(needle)) {
+        positions.push_back(position);
+    }
+    return positions;
+}
+
+std::string make_text(const std::size_t length, const std::uint32_t alphabet) {
+    std::string text;
+    random_generator rng{12345};
+    for (std::size_t i = 0; i < length; ++i) {
+        text += static_cast<char>('a' + rng.next(alphabet));
+    }
+    return text;
+}
+
+constexpr std::array<std::size_t, 6> chunk_sizes{1, 2, 3, 7, 64, 1000};
+
+TEST_CASE("thread_pool", "[parallel]") {
+    SECTION("every task is executed once") {
+        bs::par::thread_pool pool(4);
+        CHECK(pool.concurrency() == 4);
+        std::vector<std::atomic<int>> calls(1000);
+        for (int repeat = 0; repeat < 20; ++repeat) {
+            pool.bulk_execute(calls.size(), [&](const std::size_t i) { calls[i].fetch_add(1); });
+        }
+        CHECK(std::all_of(calls.begin(), calls.end(), [](const std::atomic<int>& count) { return count.load() == 20; }));
+        pool.bulk_execute(0, [](std::size_t) { FAIL("no tasks"); });
+    }
+    SECTION("exception") {
+        bs::par::thread_pool pool(3);
+        CHECK_THROWS_AS(pool.bulk_execute(100, [](const std::size_t i) {
+            if (i == 42) { throw std::runtime_error("task failed"); }
+        }), std::runtime_error);
+        std::atomic<std::size_t> sum{0};
+        pool.bulk_execute(10, [&](const std::size_t i) { sum += i; });
+        CHECK(sum.load() == 45);
+    }
+    SECTION("single thread") {
+        bs::par::thread_pool pool(1);
+        CHECK(pool.concurrency() == 1);
+        std::vector<std::size_t> order;
+        pool.bulk_execute(5, [&](const std::size_t i) { order.push_back(i); });
+        CHECK(order == std::vector<std::size_t>{0, 1, 2, 3, 4});
+    }
+}
+
+TEST_CASE("par::count", "[parallel]") {
+    bs::par::thread_pool pool(4);
+    const std::string text = make_text(5000, 4);
+    const bs::string_view str(text.data(), text.size());
+    const auto expected = static_cast<std::size_t>(std::count(text.begin(), text.end(), 'a'));
+
+    for (const std::size_t chunk_size : chunk_sizes) {
+        CHECK(bs::par::count(pool, str, 'a', chunk_size) == expected);
+        CHECK(bs::par::count(bs::par::inline_executor{}, str, 'a', chunk_size) == expected);
+    }
+    CHECK(bs::par::count(str, 'a') == expected);
+    CHECK(bs::par::count(""_sv, 'a') == 0);
+    CHECK(bs::par::count(str, 'z') == 0);
+}
+
+TEST_CASE("par::find_first", "[parallel]") {
+    bs::par::thread_pool pool(4);
+    SECTION("character") {
+        const std::string text = std::string(3000, 'x') + "y" + std::string(100, 'x') + "y";
+        const bs::string_view str(text.data(), text.size());
+        for (const std::size_t chunk_size : chunk_sizes) {
+            CHECK(bs::par::find_first(pool, str, 'y', chunk_size).index() == 3000);
+            CHECK_FALSE(bs::par::find_first(pool, str, 'z', chunk_size).found());
+        }
+        CHECK(bs::par::find_first(str, 'y').index() == 3000);
+        CHECK_FALSE(bs::par::find_first(""_sv, 'y').found());
+    }
+    SECTION("string straddling chunks") {
+        const std::string text = make_text(4000, 3);
+        const bs::string_view str(text.data(), text.size());
+        const std::array<bs::string_view, 4> needles{"ab"_sv, "cab"_sv, "abcabc"_sv, "ccccccc"_sv};
+        for (const bs::string_view needle : needles) {
+            const std::size_t expected = str.find(needle).index_or_npos();
+            for (const std::size_t chunk_size : chunk_sizes) {
+                CHECK(bs::par::find_first(pool, str, needle, chunk_size).index_or_npos() == expected);
+            }
+        }
+        CHECK(bs::par::find_first("abcd"_sv, "cd"_sv).index() == 2);
+        CHECK(bs::par::find_first(pool, "aaab"_sv, "ab"_sv, 1).index() == 2);
+        CHECK_FALSE(bs::par::find_first(pool, "abc"_sv, "abcd"_sv, 1).found());
+    }
+}
+
+TEST_CASE("par::find_all", "[parallel]") {
+    bs::par::thread_pool pool(4);
+    SECTION("character") {
+        const std::string text = make_text(5000, 5);
+        const bs::string_view str(text.data(), text.size());
+        const std::vector<std::size_t> expected = sequential_find_all(str, "c"_sv);
+        for (const std::size_t chunk_size : chunk_sizes) {
+            CHECK(bs::par::find_all(pool, str, 'c', chunk_size) == expected);
+        }
+        CHECK(bs::par::find_all(str, 'c') == expected);
+        CHECK(bs::par::find_all(""_sv, 'c').empty());
+    }
+    SECTION("non-overlapping matches across chunks") {
+        const std::string repeated(1001, 'a');
+        const std::array<std::string, 3> texts{make_text(5000, 2), make_text(3000, 3), repeated};
+        const std::array<bs::string_view, 5> needles{"a"_sv, "aa"_sv, "aaa"_sv, "aba"_sv, "abab"_sv};
+        for (const std::string& text : texts) {
+            const bs::string_view str(text.data(), text.size());
+            for (const bs::string_view needle : needles) {
+                const std::vector<std::size_t> expected = sequential_find_all(str, needle);
+                for (const std::size_t chunk_size : chunk_sizes) {
+                    CHECK(bs::par::find_all(pool, str, needle, chunk_size) == expected);
+                    CHECK(bs::par::find_all(bs::par::inline_executor{}, str, needle, chunk_size) == expected);
+                }
+            }
+        }
+        CHECK(bs::par::find_all("aaaa"_sv, "aa"_sv) == std::vector<std::size_t>{0, 2});
+    }
+}
+
+TEST_CASE("par::split_index", "[parallel]") {
+    bs::par::thread_pool pool(4);
+    std::string text = make_text(3000, 6);
+    std::replace(text.begin(), text.end(), 'a', ',');
+    const bs::string_view str(text.data(), text.size());
+
+    const auto expected = bs::split_index(str, ',');
+    for (const std::size_t chunk_size : chunk_sizes) {
+        const auto fields = bs::par::split_index(pool, str, ',', chunk_size);
+        CHECK(fields.separator_offsets() == expected.separator_offsets());
+        CHECK(std::equal(fields.begin(), fields.end(), expected.begin(), expected.end()));
+
+        const auto string_fields = bs::par::split_index(pool, str, ",b"_sv, chunk_size);
+        CHECK(string_fields.separator_offsets() == bs::split_index(str, ",b"_sv).separator_offsets());
+    }
+    CHECK(bs::par::split_index(str, ',').separator_offsets() == expected.separator_offsets());
+
+    const auto empty = bs::par::split_index(""_sv, ',');
+    REQUIRE(empty.size() == 1);
+    CHECK(empty[0] == ""_sv);
+
+    const std::string long_text(300, ',');
+    CHECK_THROWS_AS(bs::par::split_index<std::uint8_t>(pool, bs::string_view(long_text.data(), long_text.size()), ','), std::length_error);
+}
+
+}
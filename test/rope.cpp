@@ -0,0 +1,200 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "util.hpp"
+#include <betterstring/rope.hpp>
+
+namespace {
+
+using namespace bs::literals;
+
+std::string random_text(random_generator& rng, const std::size_t length, const bs::string_view alphabet) {
+    std::string text;
+    for (std::size_t i = 0; i < length; ++i) {
+        text += alphabet[rng.next(alphabet.size())];
+    }
+    return text;
+}
+
+bs::string_view view_of(const std::string& str) noexcept {
+    return bs::string_view(str.data(), str.size());
+}
+
+// the AVL invariant allows the height of at most 1.45 * log2(leaf count) + 2
+bool is_balanced(const bs::rope& rope) {
+    std::size_t leaves = 0;
+    for (const bs::string_view chunk : rope.chunks()) {
+        if (chunk.empty()) { return false; }
+        ++leaves;
+    }
+    std::size_t log2 = 0;
+    while ((std::size_t(1) << log2) < leaves) { ++log2; }
+    return rope.height() <= (log2 * 3) / 2 + 2;
+}
+
+TEST_CASE("rope", "[rope]") {
+    SECTION("empty") {
+        const bs::rope rope;
+        CHECK(rope.empty());
+        CHECK(rope.size() == 0);
+        CHECK(rope.height() == 0);
+        CHECK(rope == ""_sv);
+        CHECK(rope.chunks().begin() == rope.chunks().end());
+        CHECK(rope.find('a') == bs::rope::npos);
+        CHECK(rope.find("a"_sv) == bs::rope::npos);
+        CHECK(rope.find(""_sv) == 0);
+        CHECK(rope.count(""_sv) == 1);
+    }
+    SECTION("leaves") {
+        const std::string text(3 * bs::rope::leaf_capacity + 10, 'x');
+        bs::rope rope(view_of(text));
+        CHECK(rope.size() == text.size());
+        CHECK(rope.height() == 3);
+        std::size_t position = 0;
+        for (auto it = rope.chunks().begin(); it != rope.chunks().end(); ++it) {
+            CHECK(it.position() == position);
+            CHECK((*it).size() <= bs::rope::leaf_capacity);
+            position += (*it).size();
+        }
+        CHECK(position == text.size());
+        CHECK(rope[0] == 'x');
+        CHECK(rope[-1] == 'x');
+
+        // the full leaf is split around the inserted characters
+        rope.insert(100, "inserted"_sv);
+        CHECK(rope.to_string(98, 12) == "xxinsertedxx"_sv);
+        CHECK(rope.find("inserted"_sv) == 100);
+        CHECK(rope.find('d', 101) == 107);
+        CHECK(rope.find('i', 101) == bs::rope::npos);
+        CHECK(is_balanced(rope));
+
+        rope.erase(90, 30);
+        CHECK(rope.size() == text.size() + 8 - 30);
+        CHECK(rope.count('x') == rope.size());
+    }
+    SECTION("concatenation") {
+        const std::string first(5 * bs::rope::leaf_capacity, 'a');
+        const std::string second(2 * bs::rope::leaf_capacity, 'b');
+        bs::rope rope(view_of(first));
+        bs::rope other(view_of(second));
+        rope.append(std::move(other));
+        CHECK(other.empty());
+        CHECK(rope.size() == first.size() + second.size());
+        CHECK(rope.to_string() == view_of(first + second));
+        CHECK(is_balanced(rope));
+
+        bs::rope middle("middle"_sv);
+        rope.insert(first.size(), std::move(middle));
+        CHECK(rope.find("amiddleb"_sv) == first.size() - 1);
+
+        bs::rope copy = rope;
+        CHECK(copy == rope);
+        copy.append(copy);
+        CHECK(copy.size() == 2 * rope.size());
+        copy.erase(0, rope.size());
+        CHECK(copy == rope);
+        copy.insert(0, "z"_sv);
+        CHECK(copy != rope);
+    }
+    SECTION("random edits") {
+        random_generator rng;
+        bs::rope rope;
+        std::string model;
+        for (int step = 0; step < 400; ++step) {
+            const std::size_t action = rng.next(4);
+            if (action == 0 || model.size() < 1000) {
+                const std::string text = random_text(rng, rng.next(3 * bs::rope::leaf_capacity), "abc"_sv);
+                const std::size_t position = rng.next(model.size() + 1);
+                rope.insert(position, view_of(text));
+                model.insert(position, text);
+            } else if (action == 1) {
+                const std::string text = random_text(rng, rng.next(50), "abc"_sv);
+                rope.append(view_of(text));
+                model += text;
+            } else if (action == 2) {
+                const std::size_t position = rng.next(model.size() + 1);
+                const std::size_t count = rng.next(model.size() - position + 1) / 2;
+                rope.erase(position, count);
+                model.erase(position, count);
+            } else {
+                const std::size_t position = rng.next(model.size() + 1);
+                bs::rope other(view_of(random_text(rng, rng.next(bs::rope::leaf_capacity), "abc"_sv)));
+                model.insert(position, other.to_string().data(), other.size());
+                rope.insert(position, std::move(other));
+            }
+            REQUIRE(rope.size() == model.size());
+            REQUIRE(rope == view_of(model));
+            REQUIRE(is_balanced(rope));
+        }
+        const std::size_t middle = model.size() / 2;
+        CHECK(rope[middle] == model[middle]);
+        CHECK(rope.to_string(middle, 5000) == view_of(model).substr(middle, 5000));
+    }
+    SECTION("search across chunks") {
+        random_generator rng;
+        bs::rope rope;
+        std::string model;
+        // small insertions into the middle of full leaves make chunks of various sizes
+        const std::string base = random_text(rng, 4 * bs::rope::leaf_capacity, "ab"_sv);
+        rope.append(view_of(base));
+        model = base;
+        for (int i = 0; i < 100; ++i) {
+            const std::string text = random_text(rng, rng.next(5), "ab"_sv);
+            const std::size_t position = rng.next(model.size() + 1);
+            rope.insert(position, view_of(text));
+            model.insert(position, text);
+        }
+        const bs::string_view str = view_of(model);
+        for (const bs::string_view needle : {"b"_sv, "ab"_sv, "aba"_sv, "bbbbb"_sv, "abaabbab"_sv, "aaaaaaaaaaaaaaaaaaaaaaaaaa"_sv}) {
+            CHECK(rope.count(needle) == str.count(needle));
+            for (std::size_t position = 0; position <= model.size(); position += 997) {
+                CHECK(rope.find(needle, position) == model.find(needle.data(), position, needle.size()));
+            }
+        }
+        CHECK(rope.count('a') == str.count('a'));
+        CHECK(rope.find('b', 5) == model.find('b', 5));
+        CHECK(rope.contains("ba"_sv));
+        CHECK_FALSE(rope.contains('c'));
+
+        for (const bs::string_view separator : {"a"_sv, "bab"_sv}) {
+            std::vector<std::string> expected;
+            for (const bs::string_view field : str.split(separator)) {
+                expected.emplace_back(field.data(), field.size());
+            }
+            std::vector<std::string> fields;
+            rope.split(separator, [&](const bs::string_view field) { fields.emplace_back(field.data(), field.size()); });
+            CHECK(fields == expected);
+        }
+    }
+    SECTION("chunks shorter than the needle") {
+        random_generator rng;
+        std::string model = random_text(rng, 40 * bs::rope::leaf_capacity, "ab"_sv);
+        bs::rope rope(view_of(model));
+        std::vector<std::size_t> chunk_starts;
+        for (auto it = rope.chunks().begin(); it != rope.chunks().end(); ++it) {
+            chunk_starts.push_back(it.position());
+        }
+        // keep the first and the last character of every leaf
+        for (auto it = chunk_starts.rbegin(); it != chunk_starts.rend(); ++it) {
+            rope.erase(*it + 1, bs::rope::leaf_capacity - 2);
+            model.erase(*it + 1, bs::rope::leaf_capacity - 2);
+        }
+        REQUIRE(rope == view_of(model));
+        for (const bs::string_view chunk : rope.chunks()) {
+            CHECK(chunk.size() == 2);
+        }
+        const bs::string_view str = view_of(model);
+        for (const bs::string_view needle : {"ab"_sv, "abba"_sv, "babab"_sv, str.substr(7, 9)}) {
+            CHECK(rope.count(needle) == str.count(needle));
+            CHECK(rope.find(needle, 3) == model.find(needle.data(), 3, needle.size()));
+        }
+    }
+}
+
+}
@@ -0,0 +1,112 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include <betterstring/shared_string.hpp>
+#include <betterstring/string.hpp>
+
+namespace {
+
+using namespace bs::literals;
+
+static_assert(!std::is_convertible_v<bs::shared_string, bs::string_view>);
+static_assert(std::is_constructible_v<bs::string_view, bs::shared_string>);
+static_assert(sizeof(bs::shared_string) == 3 * sizeof(void*));
+
+TEST_CASE("shared_string", "[shared_string]") {
+    SECTION("empty") {
+        const bs::shared_string empty;
+        CHECK(empty.empty());
+        CHECK(empty.use_count() == 0);
+        CHECK(empty == ""_sv);
+        const bs::shared_string from_empty(""_sv);
+        CHECK(from_empty.use_count() == 0);
+    }
+    SECTION("copies share the allocation") {
+        const bs::string payload("the payload which is broadcast to the consumers"_sv);
+        const bs::shared_string str(payload);
+        CHECK(str == "the payload which is broadcast to the consumers"_sv);
+        CHECK(str.use_count() == 1);
+        {
+            std::vector<bs::shared_string> consumers(8, str);
+            CHECK(str.use_count() == 9);
+            for (const bs::shared_string& consumer : consumers) {
+                CHECK(consumer.data() == str.data());
+            }
+        }
+        CHECK(str.use_count() == 1);
+
+        bs::shared_string moved = str;
+        const bs::shared_string target = std::move(moved);
+        CHECK(moved.empty());
+        CHECK(target.use_count() == 2);
+        moved = target;
+        CHECK(target.use_count() == 3);
+        moved = bs::shared_string("other"_sv);
+        CHECK(target.use_count() == 2);
+        CHECK(moved == "other"_sv);
+    }
+    SECTION("substr") {
+        bs::shared_string word;
+        {
+            const bs::shared_string str("key=value"_sv);
+            word = str.substr(4);
+            CHECK(word.data() == str.data() + 4);
+            CHECK(str.substr(0, 3) == "key"_sv);
+            CHECK(str.substr(9).use_count() == 0);
+            CHECK(str.use_count() == 2);
+        }
+        // the substring keeps the parent allocation alive
+        CHECK(word == "value"_sv);
+        CHECK(word.use_count() == 1);
+        CHECK(word.starts_with('v'));
+        CHECK(word.ends_with("lue"_sv));
+        CHECK(word.contains("alu"_sv));
+        CHECK(word[-1] == 'e');
+        CHECK(word.front() == 'v');
+        CHECK(word.back() == 'e');
+        CHECK_FALSE(word.at(5).has_value());
+        CHECK(bs::string_view(word) == "value"_sv);
+    }
+    SECTION("local") {
+        const bs::local_shared_string str("single thread"_sv);
+        const bs::local_shared_string copy = str;
+        CHECK(str.use_count() == 2);
+        CHECK(copy.substr(7) == "thread"_sv);
+    }
+    SECTION("hash table key") {
+        std::unordered_set<bs::shared_string, bs::hash<bs::shared_string>, std::equal_to<>> keys;
+        keys.insert(bs::shared_string("first"_sv));
+        keys.insert(bs::shared_string("second"_sv));
+        CHECK(keys.count(bs::shared_string("first"_sv)) == 1);
+        CHECK(bs::hash<bs::shared_string>{}(bs::shared_string("key"_sv)) == bs::hash<bs::string_view>{}("key"_sv));
+    }
+    SECTION("threads") {
+        const bs::shared_string str("shared between the threads"_sv);
+        std::vector<std::size_t> total_sizes(4);
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < total_sizes.size(); ++i) {
+            threads.emplace_back([str, &total = total_sizes[i]] {
+                for (int j = 0; j < 1000; ++j) {
+                    const bs::shared_string copy = str.substr(7);
+                    total += copy.size();
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        for (const std::size_t total : total_sizes) {
+            CHECK(total == 19000);
+        }
+        CHECK(str.use_count() == 1);
+    }
+}
+
+}
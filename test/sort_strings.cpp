@@ -0,0 +1,135 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "util.hpp"
+#include <betterstring/sort_strings.hpp>
+
+namespace {
+
+using namespace bs::literals;
+
+// strings with long common prefixes, duplicates, zero characters and characters above 127
+std::vector<std::string> random_strings(random_generator& rng, const std::size_t count) {
+    const std::vector<std::string> prefixes{"", "https://www.example.com/", "https://www.example.org/path/",
+        std::string("a\0b", 3), "\xff\xfe"};
+    std::vector<std::string> strs;
+    for (std::size_t i = 0; i < count; ++i) {
+        std::string str = prefixes[rng.next(prefixes.size())];
+        const std::size_t length = rng.next(20);
+        for (std::size_t j = 0; j < length; ++j) {
+            const std::size_t kind = rng.next(10);
+            str += kind == 0 ? '\0' : kind == 1 ? '\x80' : static_cast<char>('a' + rng.next(3));
+        }
+        strs.push_back(std::move(str));
+    }
+    return strs;
+}
+
+std::vector<bs::string_view> views_of(const std::vector<std::string>& strs) {
+    std::vector<bs::string_view> views;
+    for (const std::string& str : strs) {
+        views.emplace_back(str.data(), str.size());
+    }
+    return views;
+}
+
+TEST_CASE("lexicographic_less", "[sort_strings]") {
+    const bs::lexicographic_less less;
+    CHECK(less("abc"_sv, "abd"_sv));
+    CHECK(less("ab"_sv, "abc"_sv));
+    CHECK_FALSE(less("abc"_sv, "ab"_sv));
+    CHECK(less("b"_sv, "ab"_sv) == false);
+    CHECK(less("ab"_sv, "b"_sv));
+    CHECK_FALSE(less("abc"_sv, "abc"_sv));
+    CHECK(less(""_sv, "a"_sv));
+    // operator< compares the sizes first
+    CHECK("b"_sv < "ab"_sv);
+}
+
+TEST_CASE("sort_strings", "[sort_strings]") {
+    SECTION("small") {
+        std::vector<bs::string_view> strs{"pear"_sv, "apple"_sv, "fig"_sv, "apple pie"_sv, ""_sv, "app"_sv, "fig"_sv};
+        bs::sort_strings(strs);
+        CHECK(strs == std::vector<bs::string_view>{""_sv, "app"_sv, "apple"_sv, "apple pie"_sv, "fig"_sv, "fig"_sv, "pear"_sv});
+        bs::sort_strings(strs, bs::string_order::size_first);
+        CHECK(strs == std::vector<bs::string_view>{""_sv, "app"_sv, "fig"_sv, "fig"_sv, "pear"_sv, "apple"_sv, "apple pie"_sv});
+    }
+    SECTION("same order as std::sort") {
+        random_generator rng;
+        for (const std::size_t count : {0, 1, 2, 15, 17, 100, 5000}) {
+            const std::vector<std::string> owned = random_strings(rng, count);
+            std::vector<bs::string_view> strs = views_of(owned);
+            std::vector<bs::string_view> expected = strs;
+            std::sort(expected.begin(), expected.end(), bs::lexicographic_less{});
+            bs::sort_strings(strs.data(), strs.data() + strs.size());
+            CHECK(strs == expected);
+
+            std::sort(expected.begin(), expected.end());
+            bs::sort_strings(strs, bs::string_order::size_first);
+            CHECK(strs == expected);
+        }
+    }
+    SECTION("many copies of a long string") {
+        const std::string long_string(std::size_t(1) << 20, 'x');
+        std::vector<bs::string_view> views(32, bs::string_view(long_string.data(), long_string.size()));
+        bs::sort_strings(views);
+        CHECK(std::all_of(views.begin(), views.end(), [&](const bs::string_view view) {
+            return view.data() == long_string.data() && view.size() == long_string.size();
+        }));
+    }
+    SECTION("long common prefixes") {
+        const std::string prefix(std::size_t(1) << 18, 'p');
+        random_generator rng;
+        std::vector<std::string> strs;
+        for (std::size_t i = 0; i < 200; ++i) {
+            std::string str = prefix;
+            str.append(rng.next(4), static_cast<char>('a' + rng.next(3)));
+            strs.push_back(std::move(str));
+        }
+        std::vector<bs::string_view> views = views_of(strs);
+        bs::sort_strings(views);
+        std::sort(strs.begin(), strs.end());
+        CHECK(views == views_of(strs));
+    }
+    SECTION("wide characters") {
+        // sorted with std::sort and lexicographic_less
+        std::vector<bs::wstring_view> strs{L"ba"_sv, L"b"_sv, L"abc"_sv, L""_sv, L"ab"_sv};
+        bs::sort_strings(strs);
+        CHECK(strs == std::vector<bs::wstring_view>{L""_sv, L"ab"_sv, L"abc"_sv, L"b"_sv, L"ba"_sv});
+    }
+}
+
+TEST_CASE("par::sort_strings", "[sort_strings]") {
+    random_generator rng;
+    const std::vector<std::string> owned = random_strings(rng, 100000);
+    std::vector<bs::string_view> expected = views_of(owned);
+    std::sort(expected.begin(), expected.end(), bs::lexicographic_less{});
+
+    bs::par::thread_pool pool(4);
+    std::vector<bs::string_view> strs = views_of(owned);
+    bs::par::sort_strings(pool, strs.data(), strs.data() + strs.size());
+    CHECK(strs == expected);
+
+    strs = views_of(owned);
+    bs::par::sort_strings(bs::par::inline_executor{}, strs.data(), strs.data() + strs.size());
+    CHECK(strs == expected);
+
+    // all strings are equal, every string is in the same bucket
+    std::vector<bs::string_view> equal(50000, "same"_sv);
+    bs::par::sort_strings(pool, equal.data(), equal.data() + equal.size());
+    CHECK(std::all_of(equal.begin(), equal.end(), [](const bs::string_view str) { return str == "same"_sv; }));
+
+    std::sort(expected.begin(), expected.end());
+    strs = views_of(owned);
+    bs::par::sort_strings(strs, bs::string_order::size_first);
+    CHECK(strs == expected);
+}
+
+}
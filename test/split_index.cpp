@@ -0,0 +1,106 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <betterstring/split_index.hpp>
+
+namespace {
+
+using namespace bs::literals;
+
+template<class Range>
+std::vector<bs::string_view> to_vector(const Range& range) {
+    std::vector<bs::string_view> out;
+    for (const bs::string_view field : range) {
+        out.push_back(field);
+    }
+    return out;
+}
+
+TEST_CASE("split_index character", "[split_index]") {
+    SECTION("fields") {
+        const auto fields = bs::split_index("a,bc,,d"_sv, ',');
+        REQUIRE(fields.size() == 4);
+        CHECK(fields[0] == "a"_sv);
+        CHECK(fields[1] == "bc"_sv);
+        CHECK(fields[2] == ""_sv);
+        CHECK(fields[3] == "d"_sv);
+        CHECK(fields.front() == "a"_sv);
+        CHECK(fields.back() == "d"_sv);
+        CHECK(fields.separator_offsets() == std::vector<std::uint32_t>{1, 4, 5});
+    }
+    SECTION("edge cases") {
+        const auto empty = bs::split_index(""_sv, ',');
+        REQUIRE(empty.size() == 1);
+        CHECK(empty[0] == ""_sv);
+
+        const auto no_separator = bs::split_index("abc"_sv, ',');
+        REQUIRE(no_separator.size() == 1);
+        CHECK(no_separator[0] == "abc"_sv);
+
+        const auto only_separators = bs::split_index(",,"_sv, ',');
+        CHECK(to_vector(only_separators) == std::vector<bs::string_view>{""_sv, ""_sv, ""_sv});
+    }
+    SECTION("same fields as split") {
+        std::string text;
+        for (std::size_t i = 0; i < 3000; ++i) {
+            text += (i % 7 == 0 || i % 11 == 0) ? ',' : static_cast<char>('a' + i % 26);
+        }
+        const bs::string_view str(text.data(), text.size());
+        CHECK(to_vector(bs::split_index(str, ',')) == to_vector(str.split(',')));
+    }
+}
+
+TEST_CASE("split_index string", "[split_index]") {
+    const auto fields = bs::split_index("key=>value=>=>last"_sv, "=>");
+    CHECK(to_vector(fields) == std::vector<bs::string_view>{"key"_sv, "value"_sv, ""_sv, "last"_sv});
+
+    const auto lines = bs::split_index("first\r\nsecond\r\n"_sv, "\r\n"_sv);
+    CHECK(to_vector(lines) == std::vector<bs::string_view>{"first"_sv, "second"_sv, ""_sv});
+
+    const auto overlapping = bs::split_index("aaaaa"_sv, "aa"_sv);
+    CHECK(to_vector(overlapping) == to_vector("aaaaa"_sv.split("aa"_sv)));
+}
+
+TEST_CASE("split_index random access", "[split_index]") {
+    const auto fields = bs::split_index("0;1;2;3;4;5;6;7;8;9"_sv, ';');
+    REQUIRE(fields.size() == 10);
+
+    auto it = fields.begin();
+    CHECK(*(it + 3) == "3"_sv);
+    CHECK(it[9] == "9"_sv);
+    CHECK(fields.end() - fields.begin() == 10);
+    it += 5;
+    CHECK(*it == "5"_sv);
+    --it;
+    CHECK(*it-- == "4"_sv);
+    CHECK(*it == "3"_sv);
+    CHECK(it < fields.end());
+    CHECK(fields.begin() <= it);
+    CHECK(*fields.rbegin() == "9"_sv);
+    CHECK(std::distance(fields.rbegin(), fields.rend()) == 10);
+
+    const auto found = std::lower_bound(fields.begin(), fields.end(), "6"_sv);
+    CHECK(found - fields.begin() == 6);
+}
+
+TEST_CASE("split_index reuses offset buffer", "[split_index]") {
+    std::vector<std::uint64_t> buffer;
+    buffer.reserve(1024);
+    const auto* const memory = buffer.data();
+
+    for (const bs::string_view line : {"a,b,c"_sv, "d,e"_sv, ",,,,"_sv}) {
+        auto fields = bs::split_index<std::uint64_t>(line, ',', std::move(buffer));
+        CHECK(fields.size() == line.count(',') + 1);
+        buffer = std::move(fields).release_offsets();
+        CHECK(buffer.data() == memory);
+    }
+}
+
+}
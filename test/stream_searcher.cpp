@@ -0,0 +1,157 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "util.hpp"
+#include <betterstring/stream_searcher.hpp>
+
+namespace {
+
+using namespace bs::literals;
+
+std::string random_text(random_generator& rng, const std::size_t length, const bs::string_view alphabet) {
+    std::string text;
+    for (std::size_t i = 0; i < length; ++i) {
+        text += alphabet[rng.next(static_cast<std::uint32_t>(alphabet.size()))];
+    }
+    return text;
+}
+
+// splits the text into chunks of random sizes, including empty chunks
+std::vector<bs::string_view> random_chunks(random_generator& rng, const std::string& text, const std::uint32_t max_chunk) {
+    std::vector<bs::string_view> chunks;
+    std::size_t position = 0;
+    while (position < text.size()) {
+        const std::size_t rest = text.size() - position;
+        const std::size_t size = std::min<std::size_t>(rng.next(max_chunk + 1), rest);
+        chunks.emplace_back(text.data() + position, size);
+        position += size;
+    }
+    return chunks;
+}
+
+TEST_CASE("stream_searcher", "[stream_searcher]") {
+    SECTION("match spanning chunks") {
+        bs::stream_searcher searcher("needle"_sv);
+        std::vector<std::size_t> positions;
+        const auto on_match = [&](const std::size_t position) { positions.push_back(position); };
+        searcher.feed("hay ne"_sv, on_match);
+        CHECK(searcher.partial_match() == 2);
+        searcher.feed("e"_sv, on_match);
+        searcher.feed("dle hayneedle"_sv, on_match);
+        CHECK(positions == std::vector<std::size_t>{4, 14});
+        CHECK(searcher.consumed() == 20);
+
+        searcher.reset();
+        positions.clear();
+        searcher.feed("needle"_sv, on_match);
+        CHECK(positions == std::vector<std::size_t>{0});
+    }
+    SECTION("same matches as whole buffer search") {
+        random_generator rng;
+        const std::array<bs::string_view, 6> needles{"a"_sv, "ab"_sv, "aa"_sv, "aab"_sv, "abab"_sv, "aabaab"_sv};
+        for (int repeat = 0; repeat < 50; ++repeat) {
+            const std::string text = random_text(rng, 500, "ab"_sv);
+            const bs::string_view str(text.data(), text.size());
+            for (const bs::string_view needle : needles) {
+                std::vector<std::size_t> expected;
+                for (const std::size_t position : str.find_all(needle)) {
+                    expected.push_back(position);
+                }
+
+                bs::stream_searcher searcher(needle);
+                std::vector<std::size_t> positions;
+                for (const bs::string_view chunk : random_chunks(rng, text, 9)) {
+                    searcher.feed(chunk, [&](const std::size_t position) { positions.push_back(position); });
+                }
+                CHECK(positions == expected);
+            }
+        }
+    }
+}
+
+TEST_CASE("stream_any_of_searcher", "[stream_searcher]") {
+    random_generator rng;
+    for (int repeat = 0; repeat < 20; ++repeat) {
+        const std::string text = random_text(rng, 300, "abcdef"_sv);
+        std::vector<std::size_t> expected;
+        for (std::size_t i = 0; i < text.size(); ++i) {
+            if (text[i] == 'b' || text[i] == 'e') { expected.push_back(i); }
+        }
+
+        bs::stream_any_of_searcher searcher("be"_sv);
+        std::vector<std::size_t> positions;
+        for (const bs::string_view chunk : random_chunks(rng, text, 17)) {
+            searcher.feed(chunk, [&](const std::size_t position) { positions.push_back(position); });
+        }
+        CHECK(positions == expected);
+        CHECK(searcher.consumed() == text.size());
+    }
+}
+
+TEST_CASE("stream_splitter", "[stream_searcher]") {
+    SECTION("fields spanning chunks") {
+        bs::stream_splitter splitter(", "_sv);
+        std::vector<std::string> fields;
+        const auto on_field = [&](const bs::string_view field) { fields.emplace_back(field.data(), field.size()); };
+        splitter.feed("alpha, be"_sv, on_field);
+        CHECK(splitter.pending_field() == "be"_sv);
+        splitter.feed("ta,"_sv, on_field);
+        splitter.feed(" gamma, "_sv, on_field);
+        splitter.finish(on_field);
+        CHECK(fields == std::vector<std::string>{"alpha", "beta", "gamma", ""});
+    }
+    SECTION("same fields as split") {
+        random_generator rng;
+        const std::array<bs::string_view, 3> separators{","_sv, ",,"_sv, ",a,"_sv};
+        for (int repeat = 0; repeat < 50; ++repeat) {
+            const std::string text = random_text(rng, 200, "aab,"_sv);
+            const bs::string_view str(text.data(), text.size());
+            for (const bs::string_view separator : separators) {
+                std::vector<std::string> expected;
+                for (const bs::string_view field : str.split(separator)) {
+                    expected.emplace_back(field.data(), field.size());
+                }
+
+                bs::stream_splitter splitter(separator);
+                std::vector<std::string> fields;
+                const auto on_field = [&](const bs::string_view field) { fields.emplace_back(field.data(), field.size()); };
+                for (const bs::string_view chunk : random_chunks(rng, text, 7)) {
+                    splitter.feed(chunk, on_field);
+                }
+                splitter.finish(on_field);
+                CHECK(fields == expected);
+            }
+        }
+    }
+}
+
+TEST_CASE("stream_line_splitter", "[stream_searcher]") {
+    random_generator rng;
+    for (int repeat = 0; repeat < 100; ++repeat) {
+        const std::string text = random_text(rng, rng.next(120), "ab\r\n\n"_sv);
+        const bs::string_view str(text.data(), text.size());
+        std::vector<std::string> expected;
+        for (const bs::string_view line : str.lines()) {
+            expected.emplace_back(line.data(), line.size());
+        }
+
+        bs::stream_line_splitter splitter;
+        std::vector<std::string> lines;
+        const auto on_line = [&](const bs::string_view line) { lines.emplace_back(line.data(), line.size()); };
+        for (const bs::string_view chunk : random_chunks(rng, text, 11)) {
+            splitter.feed(chunk, on_line);
+        }
+        splitter.finish(on_line);
+        CHECK(lines == expected);
+    }
+}
+
+}
@@ -9,6 +9,8 @@
 #include <array>
 #include <sstream>
 #include <iomanip>
+#include <limits>
+#include <string>
 
 #include <betterstring/string.hpp>
 
@@ -172,6 +174,11 @@ TEST_CASE("operator=", "[string]") {
         str = str;
         CHECK(str == "long string long string long string long string"_sv);
     }
+    SECTION("grow long string") {
+        bs::string str{"long string long string long string", 35};
+        str = "long string long string long string long string long string long string long string long string"_sv;
+        CHECK(str == "long string long string long string long string long string long string long string long string"_sv);
+    }
     SECTION("move from another string") {
         bs::string str;
         str = bs::string{"test", 4};
@@ -209,6 +216,148 @@ TEST_CASE(".reserve_exact", "[string]") {
     CHECK(str.capacity() == 100);
 }
 
+TEST_CASE(".shrink_to_fit", "[string]") {
+    const size_t sso_capacity = bs::string{}.capacity();
+
+    bs::string str{"test", 4};
+    str.shrink_to_fit();
+    CHECK(str == "test");
+    CHECK(str.capacity() == sso_capacity);
+
+    str.reserve(100);
+    str.append("long long long long long string", 31);
+    CHECK(str.capacity() >= 100);
+    str.shrink_to_fit();
+    CHECK(str.capacity() == 35);
+    CHECK(str == "testlong long long long long string");
+
+    str.reserve(100);
+    str = "short"_sv;
+    str.shrink_to_fit();
+    CHECK(str.capacity() == sso_capacity);
+    CHECK(str == "short");
+}
+
+TEST_CASE("exact fit construction", "[string]") {
+    const char long_str[] = "long string long string long string long string";
+
+    bs::string str1{long_str, 47};
+    CHECK(str1.capacity() == 47);
+
+    bs::string str2{str1};
+    CHECK(str2.capacity() == 47);
+    CHECK(str2 == long_str);
+
+    bs::string str3 = bs::string::from_c_string(long_str);
+    CHECK(str3.capacity() == 47);
+    CHECK(str3 == long_str);
+
+    bs::string str4{bs::string_view{long_str}};
+    CHECK(str4.capacity() == 47);
+}
+
+template<class Policy>
+struct growth_test_traits : bs::char_traits<char> {
+    using growth_policy = Policy;
+};
+
+TEST_CASE("growth policy", "[string]") {
+    SECTION("policies") {
+        CHECK(bs::growth::exact::capacity(std::size_t(100)) == 100);
+        CHECK(bs::growth::one_and_half::capacity(std::size_t(100)) == 150);
+        CHECK(bs::growth::doubling::capacity(std::size_t(100)) == 200);
+        CHECK(bs::growth::power_of_two::capacity(std::size_t(100)) == 128);
+        CHECK(bs::growth::power_of_two::capacity(std::size_t(128)) == 128);
+
+        CHECK(bs::growth::doubling::capacity(std::size_t(-1) / 2 + 1) == std::size_t(-1));
+        CHECK(bs::growth::one_and_half::capacity(std::size_t(-1) - 1) == std::size_t(-1));
+        CHECK(bs::growth::power_of_two::capacity(std::size_t(-1) - 1) == std::size_t(-1));
+    }
+    SECTION("exact") {
+        bs::stringt<growth_test_traits<bs::growth::exact>> str;
+        for (std::size_t i = 0; i < 100; ++i) {
+            str.push_back('a');
+            CHECK(str.capacity() >= str.size());
+        }
+        CHECK(str.capacity() == 100);
+        str.append("bcd", 3);
+        CHECK(str.capacity() == 103);
+        str.reserve(200);
+        CHECK(str.capacity() == 200);
+
+        std::istringstream stream{"input iterator input iterator input iterator"};
+        bs::stringt<growth_test_traits<bs::growth::exact>> from_stream{std::istream_iterator<char>{stream}, std::istream_iterator<char>{}};
+        CHECK(from_stream == "inputiteratorinputiteratorinputiterator");
+    }
+    SECTION("one and half") {
+        bs::stringt<growth_test_traits<bs::growth::one_and_half>> str;
+        str.reserve(100);
+        CHECK(str.capacity() == 150);
+    }
+    SECTION("power of two") {
+        bs::stringt<growth_test_traits<bs::growth::power_of_two>> str;
+        str.reserve(100);
+        CHECK(str.capacity() == 128);
+        str.append("very long string very long string", 33);
+        str.reserve(129);
+        CHECK(str.capacity() == 256);
+    }
+}
+
+template<class Layout>
+struct layout_test_traits : bs::char_traits<char> {
+    using string_layout = Layout;
+};
+template<class Layout>
+using layout_string = bs::stringt<layout_test_traits<Layout>>;
+
+template<class Layout>
+void check_layout(const std::size_t short_capacity) {
+    layout_string<Layout> str;
+    CHECK(str.capacity() == short_capacity);
+    for (std::size_t i = 0; i < short_capacity; ++i) {
+        str.push_back(char('a' + i % 26));
+    }
+    CHECK(str.capacity() == short_capacity);
+    CHECK(str.data() == reinterpret_cast<const char*>(&str));
+    str.push_back('!');
+    CHECK(str.size() == short_capacity + 1);
+    CHECK(str.capacity() > short_capacity);
+    CHECK(str.back() == '!');
+    CHECK(str.starts_with("abc"));
+
+    layout_string<Layout> copy = str;
+    CHECK(copy == str);
+    str.shrink_to_fit();
+    str.erase(short_capacity / 2);
+    str.shrink_to_fit();
+    CHECK(str.capacity() == short_capacity);
+    CHECK(str == copy.substr(0, short_capacity / 2));
+
+    const layout_string<Layout> moved = std::move(copy);
+    CHECK(moved.size() == short_capacity + 1);
+    CHECK(copy.size() == 0);
+}
+
+TEST_CASE("string layout", "[string]") {
+    STATIC_CHECK(sizeof(bs::string) == 32);
+    STATIC_CHECK(sizeof(layout_string<bs::layout::compact>) == 16);
+    STATIC_CHECK(alignof(layout_string<bs::layout::compact>) == 16);
+    STATIC_CHECK(sizeof(layout_string<bs::layout::extended<40>>) == 40);
+    STATIC_CHECK(sizeof(layout_string<bs::layout::extended<56>>) == 56);
+    STATIC_CHECK(sizeof(layout_string<bs::layout::cache_line>) == 32);
+    STATIC_CHECK(alignof(layout_string<bs::layout::cache_line>) == 32);
+
+    STATIC_CHECK(layout_string<bs::layout::compact>::max_size() == 0x7FFFFFFF);
+    STATIC_CHECK(bs::string::max_size() == std::numeric_limits<std::size_t>::max() / 2);
+
+    check_layout<bs::layout::standard>(23);
+    check_layout<bs::layout::compact>(15);
+    check_layout<bs::layout::extended<40>>(39);
+    check_layout<bs::layout::extended<56>>(55);
+    check_layout<bs::layout::cache_line>(31);
+}
+
 TEST_CASE(".clear", "[string]") {
     bs::string str{"test string", 11};
     CHECK(str.size() == 11);
@@ -379,6 +528,86 @@ TEST_CASE(".append", "[string]") {
     }
 }
 
+TEST_CASE(".resize_and_overwrite", "[string]") {
+    bs::string str{"abc", 3};
+    str.resize_and_overwrite(10, [](char* const buf, const std::size_t count) {
+        CHECK(count == 10);
+        CHECK(buf[0] == 'a');
+        bs::strcopy(buf + 3, "defg", 4);
+        return 7;
+    });
+    CHECK(str == "abcdefg");
+
+    str.resize_and_overwrite(100, [](char* const buf, const std::size_t count) {
+        bs::strfill(buf, count, 'x');
+        return count;
+    });
+    CHECK(str.size() == 100);
+    CHECK(str.capacity() >= 100);
+    CHECK(str.substr(0, 100) == bs::string::filled('x', 100));
+
+    str.resize_and_overwrite(5, [](char*, std::size_t) { return std::size_t(2); });
+    CHECK(str == "xx");
+
+    str.resize_and_overwrite(0, [](char*, std::size_t) { return 0; });
+    CHECK(str.size() == 0);
+}
+
+TEST_CASE(".append_uninitialized", "[string]") {
+    bs::string str{"key=", 4};
+
+    char* const buf = str.append_uninitialized(5);
+    CHECK(str.size() == 4);
+    CHECK(str.capacity() >= 9);
+    bs::strcopy(buf, "value", 5);
+    str.commit(5);
+    CHECK(str == "key=value");
+
+    char* const long_buf = str.append_uninitialized(40);
+    bs::strfill(long_buf, 40, '!');
+    str.commit(10);
+    CHECK(str == "key=value!!!!!!!!!!");
+    str.commit(0);
+    CHECK(str == "key=value!!!!!!!!!!");
+}
+
+TEST_CASE(".append_all", "[string]") {
+    SECTION("string views and characters") {
+        bs::string str{"prefix", 6};
+        str.append_all(':', "id"_sv, ':', bs::string{"suffix", 6});
+        CHECK(str == "prefix:id:suffix");
+        str.append_all();
+        CHECK(str == "prefix:id:suffix");
+        str.append_all(" and a very long string that does not fit into the small buffer", '!');
+        CHECK(str == "prefix:id:suffix and a very long string that does not fit into the small buffer!");
+    }
+    SECTION("integers") {
+        bs::string str;
+        str.append_all(0, ' ', 7, ' ', -7, ' ', 1234567890, ' ', std::uint8_t(255), ' ', short(-300));
+        CHECK(str == "0 7 -7 1234567890 255 -300");
+
+        str.clear();
+        str.append_all(std::numeric_limits<long long>::min(), ' ', std::numeric_limits<std::uint64_t>::max());
+        CHECK(str == "-9223372036854775808 18446744073709551615");
+    }
+    SECTION("pieces referring to the string itself") {
+        bs::string str{"abc", 3};
+        str.append_all(str, '-', str.substr(1), '-', str);
+        CHECK(str == "abcabc-bc-abc");
+        str.append_all(str, str, str);
+        CHECK(str == "abcabc-bc-abcabcabc-bc-abcabcabc-bc-abcabcabc-bc-abc");
+    }
+}
+
+TEST_CASE("concat", "[string]") {
+    CHECK(bs::concat() == "");
+    CHECK(bs::concat("prefix", ':', 42, ':', "suffix"_sv) == "prefix:42:suffix");
+
+    const bs::string key = bs::concat("user", ':', 1234567890123ULL, ':', "session", ':', -1, ':', "long long long suffix");
+    CHECK(key == "user:1234567890123:session:-1:long long long suffix");
+    CHECK(key.capacity() == key.size());
+}
+
 TEST_CASE("literals", "[string]") {
     bs::string str = "test string"_s;
     CHECK(str == "test string"_sv);
@@ -401,6 +630,161 @@ TEST_CASE(".substr", "[string]") {
     CHECK(str.substr(1, 10) == "est string"_sv);
 }
 
+TEST_CASE(".insert", "[string]") {
+    bs::string str = "hello"_s;
+    str.insert(5, " world"_sv);
+    CHECK(str == "hello world");
+    str.insert(0, '>');
+    CHECK(str == ">hello world");
+    str.insert(6, ","_sv);
+    CHECK(str == ">hello, world");
+    str.insert(13, " and a very long string that does not fit into the small buffer"_sv);
+    CHECK(str == ">hello, world and a very long string that does not fit into the small buffer");
+    str.insert(0, ""_sv);
+    CHECK(str == ">hello, world and a very long string that does not fit into the small buffer");
+}
+
+TEST_CASE(".erase", "[string]") {
+    bs::string str = "hello, world and a very long string that does not fit into the small buffer"_s;
+    str.erase(12, str.size() - 12);
+    CHECK(str == "hello, world");
+    str.erase(5, 1);
+    CHECK(str == "hello world");
+    str.erase(0, 0);
+    CHECK(str == "hello world");
+    str.erase(5);
+    CHECK(str == "hello");
+    str.erase(0, 5);
+    CHECK(str == "");
+}
+
+TEST_CASE(".replace", "[string]") {
+    SECTION("basic") {
+        bs::string str = "hello world"_s;
+        str.replace(0, 5, "goodbye"_sv);
+        CHECK(str == "goodbye world");
+        str.replace(8, 5, "all"_sv);
+        CHECK(str == "goodbye all");
+        str.replace(7, 0, ","_sv);
+        CHECK(str == "goodbye, all");
+        str.replace(0, 12, ""_sv);
+        CHECK(str == "");
+    }
+    SECTION("source inside the string") {
+        // compares every replacement with a substring of the string itself against std::string,
+        // with and without enough capacity to edit in place
+        const std::string original = "0123456789abcdefghijklmnopqrstuvwxyz";
+        const std::size_t length = original.size();
+        for (const bool in_place : {false, true}) {
+            for (std::size_t pos = 0; pos <= length; pos += 3) {
+                for (std::size_t count = 0; count <= length - pos; count += 5) {
+                    for (std::size_t src_pos = 0; src_pos <= length; src_pos += 4) {
+                        for (std::size_t src_len = 0; src_len <= length - src_pos; src_len += 7) {
+                            bs::string str{original.data(), original.size()};
+                            if (in_place) { str.reserve(2 * length); }
+                            str.replace(pos, count, str.substr(src_pos, src_len));
+
+                            std::string expected = original;
+                            expected.replace(pos, count, original, src_pos, src_len);
+                            CHECK(bs::string_view(str) == bs::string_view(expected.data(), expected.size()));
+                        }
+                    }
+                }
+            }
+        }
+    }
+    SECTION("insert itself") {
+        bs::string str = "abc"_s;
+        str.insert(1, str);
+        CHECK(str == "aabcbc");
+        str.reserve(64);
+        str.insert(3, str.substr(2));
+        CHECK(str == "aabbcbccbc");
+    }
+}
+
+TEST_CASE(".resize", "[string]") {
+    bs::string str = "hello"_s;
+    str.resize(2);
+    CHECK(str == "he");
+    str.resize(5, '!');
+    CHECK(str == "he!!!");
+    str.resize(40, '.');
+    CHECK(str.size() == 40);
+    CHECK(str.substr(0, 6) == "he!!!."_sv);
+    CHECK(str.capacity() >= 40);
+    str.resize(0);
+    CHECK(str == "");
+    str.resize(3);
+    CHECK(str.size() == 3);
+    CHECK(str[0] == '\0');
+}
+
+TEST_CASE(".remove_prefix_inplace", "[string]") {
+    bs::string str = "GET /index.html HTTP/1.1"_s;
+    str.remove_prefix_inplace(4);
+    CHECK(str == "/index.html HTTP/1.1");
+    str.remove_prefix_inplace(0);
+    CHECK(str == "/index.html HTTP/1.1");
+    str.remove_prefix_inplace(str.size());
+    CHECK(str == "");
+}
+
+TEST_CASE("operator+", "[string]") {
+    const bs::string hello = "hello"_s;
+    const bs::string_view world = "world"_sv;
+
+    SECTION("materialization") {
+        const bs::string str = hello + ' ' + world;
+        CHECK(str == "hello world");
+        CHECK(str.capacity() >= str.size());
+
+        const bs::string empty = bs::string{} + ""_sv;
+        CHECK(empty == "");
+
+        const bs::string long_str = hello + ", " + world + " and a very long string that does not fit into the small buffer" + '!';
+        CHECK(long_str == "hello, world and a very long string that does not fit into the small buffer!");
+        CHECK(long_str.capacity() == long_str.size());
+    }
+    SECTION("operands") {
+        CHECK(bs::string(world + world) == "worldworld");
+        CHECK(bs::string("[" + hello + "]") == "[hello]");
+        CHECK(bs::string('<' + world + '>') == "<world>");
+        CHECK(bs::string(hello + hello.substr(1, 2)) == "helloel");
+        CHECK(bs::string((hello + ' ') + (world + '!')) == "hello world!");
+
+        const auto expr = hello + world;
+        CHECK(expr.size() == 10);
+        CHECK(bs::string(expr) == "helloworld");
+    }
+    SECTION("assignment") {
+        bs::string str = "previous"_s;
+        str = hello + '-' + world;
+        CHECK(str == "hello-world");
+    }
+    SECTION("operator+=") {
+        bs::string str;
+        str += hello;
+        str += ' ';
+        str += "big"_sv;
+        CHECK(str == "hello big");
+        str += ' ' + world + ", the string is long enough to not fit into the small buffer";
+        CHECK(str == "hello big world, the string is long enough to not fit into the small buffer");
+    }
+    SECTION("operator+= with the string itself") {
+        bs::string str = "abc"_s;
+        str += str + '-' + str.substr(1);
+        CHECK(str == "abcabc-bc");
+        str += str + str + str;
+        CHECK(str == "abcabc-bcabcabc-bcabcabc-bcabcabc-bc");
+    }
+    SECTION("constexpr expression") {
+        constexpr auto expr = "hello"_sv + ' ' + "world"_sv + '!';
+        STATIC_CHECK(expr.size() == 12);
+        CHECK(bs::string(expr) == "hello world!");
+    }
+}
+
 TEST_CASE(".contains", "[string]") {
     bs::string str = "hello world"_s;
 
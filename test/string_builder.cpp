@@ -0,0 +1,135 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "util.hpp"
+#include <betterstring/string_builder.hpp>
+
+namespace {
+
+using namespace bs::literals;
+
+std::string joined_segments(const bs::string_builder& builder) {
+    std::string out;
+    for (const bs::string_view part : builder.segments()) {
+        CHECK_FALSE(part.empty());
+        out.append(part.data(), part.size());
+    }
+    return out;
+}
+
+TEST_CASE("string_builder", "[string_builder]") {
+    SECTION("empty") {
+        const bs::string_builder builder;
+        CHECK(builder.empty());
+        CHECK(builder.capacity() == 0);
+        CHECK(builder.segments().begin() == builder.segments().end());
+        CHECK(builder.build() == ""_sv);
+    }
+    SECTION("append") {
+        bs::string_builder builder;
+        builder.append("key"_sv);
+        builder += '=';
+        builder.append(-42);
+        builder.append(' ');
+        builder.append(std::numeric_limits<std::int64_t>::min());
+        builder.append(' ');
+        builder.append(std::uint8_t(255));
+        builder.append(' ');
+        builder.append(0.1);
+        builder.append(' ');
+        builder.append(1e100);
+        builder.append(' ');
+        builder.append(-2.5f);
+        builder.append_all(' ', "id:"_sv, 7u, ';');
+        const bs::string_view expected = "key=-42 -9223372036854775808 255 0.1 1e+100 -2.5 id:7;"_sv;
+        CHECK(builder.size() == expected.size());
+        CHECK(builder.build() == expected);
+
+        char buffer[64];
+        CHECK(builder.build(buffer, sizeof(buffer)) == expected.size());
+        CHECK(bs::string_view(buffer, expected.size()) == expected);
+    }
+    SECTION("segments") {
+        bs::string_builder builder;
+        std::string model;
+        random_generator rng{1};
+        for (int i = 0; i < 20000; ++i) {
+            const std::size_t length = rng.next(300);
+            const std::string piece(length, static_cast<char>('a' + i % 26));
+            builder.append(bs::string_view(piece.data(), piece.size()));
+            builder.append(i);
+            model += piece;
+            model += std::to_string(i);
+        }
+        CHECK(builder.size() == model.size());
+        CHECK(joined_segments(builder) == model);
+        CHECK(builder.build() == bs::string_view(model.data(), model.size()));
+
+        std::size_t segment_count = 0;
+        for (const bs::string_view part : builder.segments()) {
+            CHECK(part.size() <= bs::string_builder::max_segment_capacity);
+            ++segment_count;
+        }
+        // the capacity of the segments grows geometrically
+        CHECK(segment_count < 20);
+        CHECK(builder.capacity() < 2 * builder.size() + bs::string_builder::max_segment_capacity);
+    }
+    SECTION("large append") {
+        bs::string_builder builder;
+        builder.append("head"_sv);
+        const std::string large(3 * bs::string_builder::max_segment_capacity, 'x');
+        builder.append(bs::string_view(large.data(), large.size()));
+        CHECK(builder.size() == large.size() + 4);
+        CHECK(joined_segments(builder) == "head" + large);
+    }
+    SECTION("reserve_hint") {
+        bs::string_builder builder(100000);
+        const std::size_t capacity = builder.capacity();
+        CHECK(capacity >= 100000);
+        for (int i = 0; i < 10000; ++i) {
+            builder.append("0123456789"_sv);
+        }
+        CHECK(builder.capacity() == capacity);
+
+        builder.reserve_hint(1000000);
+        CHECK(builder.capacity() >= builder.size() + 1000000);
+        const std::size_t reserved = builder.capacity();
+        for (int i = 0; i < 100000; ++i) {
+            builder.append(1234567890);
+        }
+        CHECK(builder.capacity() == reserved);
+        CHECK(builder.size() == 1100000);
+    }
+    SECTION("clear reuses the segments") {
+        bs::string_builder builder;
+        for (int i = 0; i < 100000; ++i) {
+            builder.append(i);
+        }
+        const std::size_t capacity = builder.capacity();
+        builder.clear();
+        CHECK(builder.empty());
+        CHECK(builder.segments().begin() == builder.segments().end());
+        std::string model;
+        for (int i = 0; i < 100000; ++i) {
+            builder.append(i);
+            model += std::to_string(i);
+        }
+        CHECK(builder.capacity() == capacity);
+        CHECK(joined_segments(builder) == model);
+
+        bs::string_builder moved = std::move(builder);
+        CHECK(builder.empty());
+        CHECK(moved.size() == model.size());
+        moved.release();
+        CHECK(moved.capacity() == 0);
+    }
+}
+
+}
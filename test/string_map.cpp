@@ -0,0 +1,137 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+
+#include "util.hpp"
+#include <betterstring/string_map.hpp>
+
+namespace {
+
+using namespace bs::literals;
+
+bs::string_view view_of(const std::string& str) noexcept {
+    return bs::string_view(str.data(), str.size());
+}
+
+TEST_CASE("string_map", "[string_map]") {
+    SECTION("short and long keys") {
+        bs::string_map<int> map;
+        CHECK(map.empty());
+        CHECK(map.find("key"_sv) == map.end());
+        CHECK(map.begin() == map.end());
+
+        map["short"_sv] = 1;
+        map["a key which does not fit into the slot"_sv] = 2;
+        map[""_sv] = 3;
+        CHECK(map.size() == 3);
+        CHECK(map.contains("short"_sv));
+        CHECK(map.at("a key which does not fit into the slot"_sv).value() == 2);
+        CHECK(map.at(""_sv).value() == 3);
+        CHECK_FALSE(map.at("shor"_sv).has_value());
+
+        const auto [it, inserted] = map.try_emplace("short"_sv, 10);
+        CHECK_FALSE(inserted);
+        CHECK(it.key() == "short"_sv);
+        CHECK(it->second == 1);
+        CHECK(map.insert_or_assign("short"_sv, 10).second == false);
+        CHECK(map.at("short"_sv).value() == 10);
+
+        CHECK(map.erase("short"_sv) == 1);
+        CHECK(map.erase("short"_sv) == 0);
+        CHECK(map.size() == 2);
+
+        map.clear();
+        CHECK(map.empty());
+        CHECK_FALSE(map.contains(""_sv));
+    }
+    SECTION("same content as std::map") {
+        random_generator rng;
+        bs::string_map<std::string> map;
+        std::map<std::string, std::string> expected;
+        for (int i = 0; i < 20000; ++i) {
+            const std::string key = "key" + std::to_string(rng.next(3000)) + std::string(rng.next(40), 'x');
+            switch (rng.next(3)) {
+            case 0:
+                map.insert_or_assign(view_of(key), key + "value");
+                expected[key] = key + "value";
+                break;
+            case 1:
+                CHECK(map.erase(view_of(key)) == expected.erase(key));
+                break;
+            case 2:
+                CHECK(map.contains(view_of(key)) == (expected.count(key) == 1));
+                break;
+            }
+        }
+        CHECK(map.size() == expected.size());
+        std::size_t visited = 0;
+        for (const auto [key, value] : map) {
+            const auto found = expected.find(std::string(key.data(), key.size()));
+            REQUIRE(found != expected.end());
+            CHECK(value == found->second);
+            ++visited;
+        }
+        CHECK(visited == expected.size());
+        // the load factor is not exceeded
+        CHECK(map.size() <= map.capacity() - map.capacity() / 8);
+    }
+    SECTION("erase while iterating") {
+        bs::string_map<int> map(100);
+        const std::size_t capacity = map.capacity();
+        for (int i = 0; i < 100; ++i) {
+            map[view_of(std::to_string(i))] = i;
+        }
+        CHECK(map.capacity() == capacity);
+        for (auto it = map.begin(); it != map.end();) {
+            it = it.value() % 2 == 0 ? map.erase(it) : std::next(it);
+        }
+        CHECK(map.size() == 50);
+        CHECK(map.contains("99"_sv));
+        CHECK_FALSE(map.contains("98"_sv));
+    }
+    SECTION("erased long keys are reclaimed") {
+        bs::string_map<int> map;
+        const std::string prefix(100, 'k');
+        for (int i = 0; i < 10; ++i) {
+            map[view_of(prefix + "live" + std::to_string(i))] = i;
+        }
+        for (int i = 0; i < 100000; ++i) {
+            const std::string key = prefix + std::to_string(i);
+            map[view_of(key)] = i;
+            CHECK(map.erase(view_of(key)) == 1);
+        }
+        CHECK(map.size() == 10);
+        // 10 MB of the erased keys without the compaction
+        CHECK(map.key_bytes_reserved() < 64 * 1024);
+        for (int i = 0; i < 10; ++i) {
+            CHECK(map.at(view_of(prefix + "live" + std::to_string(i))).value().get() == i);
+        }
+    }
+    SECTION("copy and move") {
+        bs::string_map<std::string> map;
+        map["one"_sv] = "1";
+        map["a long key of the map which is copied"_sv] = "2";
+
+        bs::string_map<std::string> copy = map;
+        map["one"_sv] = "changed";
+        CHECK(copy.at("one"_sv).value().get() == "1");
+        CHECK(copy.at("a long key of the map which is copied"_sv).value().get() == "2");
+
+        bs::string_map<std::string> moved = std::move(copy);
+        CHECK(moved.size() == 2);
+        CHECK(moved.at("a long key of the map which is copied"_sv).value().get() == "2");
+
+        copy = moved;
+        moved.clear();
+        CHECK(copy.size() == 2);
+        CHECK(copy.contains("one"_sv));
+    }
+}
+
+}
@@ -0,0 +1,78 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <betterstring/string_switch.hpp>
+
+namespace {
+
+using namespace bs::literals;
+
+enum class http_method { get, head, post, put, delete_, connect, options, trace, patch };
+
+constexpr auto http_methods = bs::make_string_switch(
+    "GET"_sv, "HEAD"_sv, "POST"_sv, "PUT"_sv, "DELETE"_sv, "CONNECT"_sv, "OPTIONS"_sv, "TRACE"_sv, "PATCH"_sv);
+
+TEST_CASE("string_switch", "[string_switch]") {
+    SECTION("constexpr") {
+        STATIC_CHECK(http_methods.find("GET"_sv) == 0);
+        STATIC_CHECK(http_methods.find("PATCH"_sv) == 8);
+        STATIC_CHECK(http_methods.find("GETS"_sv) == http_methods.npos);
+        STATIC_CHECK(http_methods.find_as<http_method>("DELETE"_sv) == http_method::delete_);
+        STATIC_CHECK(http_methods.hashed_positions() <= 4);
+    }
+    SECTION("runtime") {
+        for (std::size_t i = 0; i < http_methods.size(); ++i) {
+            const bs::string_view key = http_methods.keys()[i];
+            const std::string copy(key.data(), key.size());
+            CHECK(http_methods.find(bs::string_view(copy.data(), copy.size())) == i);
+        }
+        CHECK_FALSE(http_methods.find_as<http_method>("get"_sv).has_value());
+        CHECK_FALSE(http_methods.contains(""_sv));
+        CHECK_FALSE(http_methods.contains("POSTED"_sv));
+        CHECK_FALSE(http_methods.contains("PUS"_sv));
+    }
+    SECTION("keys differing only in the middle") {
+        // the same length and the same first and last characters, the whole string is hashed
+        std::vector<std::string> storage;
+        std::array<bs::string_view, 100> keys;
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            storage.push_back(std::string(70, 'a') + std::to_string(1000 + i) + std::string(70, 'z'));
+        }
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            keys[i] = bs::string_view(storage[i].data(), storage[i].size());
+        }
+        const bs::string_switch<100> words(keys);
+        CHECK(words.hashed_positions() == words.npos);
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            CHECK(words.find(keys[i]) == i);
+        }
+        CHECK_FALSE(words.contains(bs::string_view(storage[0].data(), storage[0].size() - 1)));
+    }
+    SECTION("many keys") {
+        std::vector<std::string> storage;
+        std::array<bs::string_view, 256> keys;
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            storage.push_back("command_" + std::to_string(i * 37));
+        }
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            keys[i] = bs::string_view(storage[i].data(), storage[i].size());
+        }
+        const bs::string_switch<256> commands(keys);
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            CHECK(commands.find(keys[i]) == i);
+        }
+        CHECK_FALSE(commands.contains("command_1"_sv));
+    }
+    SECTION("duplicate keys") {
+        CHECK_THROWS_AS(bs::make_string_switch("a"_sv, "b"_sv, "a"_sv), std::logic_error);
+    }
+}
+
+}
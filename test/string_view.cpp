@@ -8,6 +8,9 @@
 #include <array>
 #include <iterator>
 #include <vector>
+#include <string>
+#include <cstdint>
+#include <algorithm>
 
 #include <betterstring/string_view.hpp>
 #include <betterstring/ascii.hpp>
@@ -16,6 +19,9 @@ namespace {
 
 using namespace bs::literals;
 
+constexpr std::size_t needle_size(const char) noexcept { return 1; }
+constexpr std::size_t needle_size(const bs::string_view needle) noexcept { return needle.size(); }
+
 TEST_CASE("constructor", "[string_view]") {
     SECTION("default constructor") {
         const bs::string_view empty_str;
@@ -342,6 +348,78 @@ TEST_CASE("rsplit", "[string_view]") {
     using Catch::Matchers::RangeEquals;
 
     CHECK_THAT("test string"_sv.rsplit(' '), RangeEquals(std::array{"string"_sv, "test"_sv}));
+    CHECK_THAT("a, b, c"_sv.rsplit(", "_sv), RangeEquals(std::array{"c"_sv, "b"_sv, "a"_sv}));
+}
+
+TEST_CASE("split_n", "[string_view]") {
+    using Catch::Matchers::RangeEquals;
+
+    CHECK_THAT("a b c d"_sv.split_n(' ', 2), RangeEquals(std::array{"a"_sv, "b c d"_sv}));
+    CHECK_THAT("a b c d"_sv.split_n(' ', 1), RangeEquals(std::array{"a b c d"_sv}));
+    CHECK_THAT("a b c d"_sv.split_n(' ', 4), RangeEquals(std::array{"a"_sv, "b"_sv, "c"_sv, "d"_sv}));
+    CHECK_THAT("a b c d"_sv.split_n(' ', 10), RangeEquals(std::array{"a"_sv, "b"_sv, "c"_sv, "d"_sv}));
+    CHECK_THAT("key: value: with colon"_sv.split_n(": "_sv, 2), RangeEquals(std::array{"key"_sv, "value: with colon"_sv}));
+    CHECK_THAT(""_sv.split_n(' ', 3), RangeEquals(std::array{""_sv}));
+
+    SECTION("reverse") {
+        const auto split = "a,b,c"_sv.split_n(',', 2);
+        CHECK_THAT(std::vector(split.rbegin(), split.rend()), RangeEquals(std::array{"b,c"_sv, "a"_sv}));
+        const auto whole = "a,b,c"_sv.split_n(',', 1);
+        CHECK_THAT(std::vector(whole.rbegin(), whole.rend()), RangeEquals(std::array{"a,b,c"_sv}));
+        const auto all = "a,b,c"_sv.split_n(',', 10);
+        CHECK_THAT(std::vector(all.rbegin(), all.rend()), RangeEquals(std::array{"c"_sv, "b"_sv, "a"_sv}));
+        const auto colons = "key: value: with colon"_sv.split_n(": "_sv, 2);
+        CHECK_THAT(std::vector(colons.rbegin(), colons.rend()), RangeEquals(std::array{"value: with colon"_sv, "key"_sv}));
+    }
+}
+
+TEST_CASE("split_any_of", "[string_view]") {
+    using Catch::Matchers::RangeEquals;
+
+    CHECK_THAT("a,b;c\td"_sv.split_any_of(",;\t"_sv), RangeEquals(std::array{"a"_sv, "b"_sv, "c"_sv, "d"_sv}));
+    CHECK_THAT("a,;b"_sv.split_any_of(",;"_sv), RangeEquals(std::array{"a"_sv, ""_sv, "b"_sv}));
+    CHECK_THAT(",a,"_sv.split_any_of(",;"_sv), RangeEquals(std::array{""_sv, "a"_sv, ""_sv}));
+    CHECK_THAT("abc"_sv.split_any_of(",;"_sv), RangeEquals(std::array{"abc"_sv}));
+
+    SECTION("reverse") {
+        const auto split = "a,b;c"_sv.split_any_of(",;"_sv);
+        CHECK_THAT(std::vector(split.rbegin(), split.rend()), RangeEquals(std::array{"c"_sv, "b"_sv, "a"_sv}));
+        const auto empty_fields = ",a;"_sv.split_any_of(",;"_sv);
+        CHECK_THAT(std::vector(empty_fields.rbegin(), empty_fields.rend()), RangeEquals(std::array{""_sv, "a"_sv, ""_sv}));
+    }
+
+    std::string text;
+    for (std::size_t i = 0; i < 500; ++i) {
+        text += (i % 7 == 0) ? ',' : (i % 11 == 0 ? ';' : 'x');
+    }
+    std::vector<bs::string_view> expected;
+    for (const bs::string_view part : bs::string_view(text.data(), text.size()).split(',')) {
+        for (const bs::string_view field : part.split(';')) {
+            expected.push_back(field);
+        }
+    }
+    CHECK_THAT(bs::string_view(text.data(), text.size()).split_any_of(",;"_sv), RangeEquals(expected));
+}
+
+TEST_CASE("split_whitespace", "[string_view]") {
+    using Catch::Matchers::RangeEquals;
+
+    CHECK_THAT("  hello \t world\n"_sv.split_whitespace(), RangeEquals(std::array{"hello"_sv, "world"_sv}));
+    CHECK_THAT("one\r\ntwo\vthree\ffour"_sv.split_whitespace(), RangeEquals(std::array{"one"_sv, "two"_sv, "three"_sv, "four"_sv}));
+    CHECK_THAT("word"_sv.split_whitespace(), RangeEquals(std::array{"word"_sv}));
+    CHECK(std::distance(""_sv.split_whitespace().begin(), ""_sv.split_whitespace().end()) == 0);
+    CHECK(std::distance(" \t\n "_sv.split_whitespace().begin(), " \t\n "_sv.split_whitespace().end()) == 0);
+}
+
+TEST_CASE("lines", "[string_view]") {
+    using Catch::Matchers::RangeEquals;
+
+    CHECK_THAT("first\nsecond\r\nthird"_sv.lines(), RangeEquals(std::array{"first"_sv, "second"_sv, "third"_sv}));
+    CHECK_THAT("first\r\nsecond\r\n"_sv.lines(), RangeEquals(std::array{"first"_sv, "second"_sv}));
+    CHECK_THAT("first\n\n\nlast"_sv.lines(), RangeEquals(std::array{"first"_sv, ""_sv, ""_sv, "last"_sv}));
+    CHECK_THAT("\r\n"_sv.lines(), RangeEquals(std::array{""_sv}));
+    CHECK_THAT("line\rwith carriage return"_sv.lines(), RangeEquals(std::array{"line\rwith carriage return"_sv}));
+    CHECK(std::distance(""_sv.lines().begin(), ""_sv.lines().end()) == 0);
 }
 
 TEST_CASE("strip", "[string_view]") {
@@ -614,6 +692,95 @@ TEST_CASE("rfind_not", "[string_view]") {
     }
 }
 
+TEST_CASE("find_all", "[string_view]") {
+    const auto collect = [](const auto& range) {
+        std::vector<std::size_t> positions;
+        for (const std::size_t position : range) {
+            positions.push_back(position);
+        }
+        return positions;
+    };
+    // the positions found with repeated find calls
+    const auto expected_positions = [](const bs::string_view str, const auto needle) {
+        std::vector<std::size_t> positions;
+        std::size_t start = 0;
+        while (start <= str.size()) {
+            const auto result = str.find(needle, start);
+            if (!result.index_opt()) { break; }
+            positions.push_back(result.index());
+            start = result.index() + needle_size(needle);
+        }
+        return positions;
+    };
+
+    SECTION("character") {
+        CHECK(collect(""_sv.find_all('a')).empty());
+        CHECK(collect("bcd"_sv.find_all('a')).empty());
+        CHECK(collect("abca"_sv.find_all('a')) == std::vector<std::size_t>{0, 3});
+
+        std::string text;
+        for (std::size_t i = 0; i < 1000; ++i) {
+            text += (i % 7 == 0 || i % 64 == 63 || i % 130 == 0) ? '\n' : 'x';
+            const bs::string_view str(text.data(), text.size());
+            REQUIRE(collect(str.find_all('\n')) == expected_positions(str, '\n'));
+        }
+    }
+    SECTION("string") {
+        CHECK(collect("abc"_sv.find_all("abcd"_sv)).empty());
+        CHECK(collect("abc"_sv.find_all("abc"_sv)) == std::vector<std::size_t>{0});
+        CHECK(collect("aaaa"_sv.find_all("aa"_sv)) == std::vector<std::size_t>{0, 2});
+        CHECK(collect("aaaaa"_sv.find_all("aaa"_sv)) == std::vector<std::size_t>{0});
+        CHECK(collect("a\r\nb\r\n\r\n"_sv.find_all("\r\n"_sv)) == std::vector<std::size_t>{1, 4, 6});
+
+        std::string text;
+        for (std::size_t i = 0; i < 600; ++i) {
+            text += (i % 5 == 0 || i % 64 == 62) ? "<br>" : (i % 3 == 0 ? "<b" : "x");
+            const bs::string_view str(text.data(), text.size());
+            for (const bs::string_view needle : {"<"_sv, "<b"_sv, "<br>"_sv, "x<b"_sv, "><br"_sv}) {
+                REQUIRE(collect(str.find_all(needle)) == expected_positions(str, needle));
+            }
+        }
+    }
+    SECTION("positions_into") {
+        std::string text;
+        for (std::size_t i = 0; i < 5000; ++i) {
+            text += (i % 3 == 0) ? ',' : 'x';
+        }
+        const bs::string_view str(text.data(), text.size());
+        const std::vector<std::size_t> expected = expected_positions(str, ',');
+
+        std::vector<std::uint32_t> all(expected.size() + 10);
+        REQUIRE(str.find_all(',').positions_into(all.data(), all.size()) == expected.size());
+        CHECK(std::equal(expected.begin(), expected.end(), all.begin()));
+
+        // drain the matches in small batches
+        std::vector<std::uint64_t> collected;
+        std::array<std::uint64_t, 7> batch{};
+        auto it = str.find_all(',').begin();
+        while (true) {
+            const std::size_t written = it.positions_into(batch.data(), batch.size());
+            if (written == 0) { break; }
+            collected.insert(collected.end(), batch.begin(), batch.begin() + static_cast<std::ptrdiff_t>(written));
+        }
+        CHECK(std::equal(expected.begin(), expected.end(), collected.begin(), collected.end()));
+
+        std::array<std::uint32_t, 4> fields{};
+        CHECK("a::b::c"_sv.find_all("::"_sv).positions_into(fields.data(), fields.size()) == 2);
+        CHECK(fields[0] == 1);
+        CHECK(fields[1] == 4);
+    }
+    SECTION("constexpr") {
+        constexpr auto count_matches = [](const bs::string_view str, const bs::string_view needle) {
+            std::size_t count = 0;
+            for (const std::size_t position : str.find_all(needle)) {
+                count += position < str.size() ? 1 : 0;
+            }
+            return count;
+        };
+        STATIC_CHECK(count_matches("one, two, three, four"_sv, ", "_sv) == 3);
+    }
+}
+
 TEST_CASE("bs::string_view type properties", "[string_view]") {
     CHECK(std::is_trivially_copy_constructible_v<bs::string_view>);
     CHECK(std::is_trivially_move_constructible_v<bs::string_view>);
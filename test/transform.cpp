@@ -0,0 +1,96 @@
+// Copyright 2024.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+#include <betterstring/transform.hpp>
+
+namespace {
+
+using namespace bs::literals;
+
+TEST_CASE("replace_all character", "[transform]") {
+    CHECK(bs::replace_all("a,b,,c"_sv, ',', ';') == "a;b;;c");
+    CHECK(bs::replace_all(""_sv, ',', ';') == "");
+    CHECK(bs::replace_all("abc"_sv, ',', ';') == "abc");
+
+    const bs::string long_str = bs::replace_all("path/to/some/file/that/does/not/fit/into/small/buffer"_s, '/', '\\');
+    CHECK(long_str == "path\\to\\some\\file\\that\\does\\not\\fit\\into\\small\\buffer");
+    CHECK(long_str.capacity() == long_str.size());
+}
+
+TEST_CASE("replace_all character with string", "[transform]") {
+    CHECK(bs::replace_all("a,b,,c"_sv, ',', "\\,"_sv) == "a\\,b\\,\\,c");
+    CHECK(bs::replace_all("a,b,,c"_sv, ',', ""_sv) == "abc");
+    CHECK(bs::replace_all(",,"_sv, ',', "<comma>") == "<comma><comma>");
+    CHECK(bs::replace_all("abc"_sv, ',', "<comma>") == "abc");
+    CHECK(bs::replace_all(""_sv, ',', "<comma>") == "");
+
+    const bs::string escaped = bs::replace_all("key=value&other=\"quoted\"&last=\"\""_sv, '"', "&quot;");
+    CHECK(escaped == "key=value&other=&quot;quoted&quot;&last=&quot;&quot;");
+    CHECK(escaped.capacity() == escaped.size());
+}
+
+TEST_CASE("replace_all string", "[transform]") {
+    CHECK(bs::replace_all("hello world"_sv, "world"_sv, "there"_sv) == "hello there");
+    CHECK(bs::replace_all("aaaa"_sv, "aa", "b") == "bb");
+    CHECK(bs::replace_all("aaa"_sv, "aa", "b") == "ba");
+    CHECK(bs::replace_all("\r\n\r\n"_sv, "\r\n", "\n") == "\n\n");
+    CHECK(bs::replace_all("abc"_sv, "abcd", "x") == "abc");
+    CHECK(bs::replace_all("abc"_sv, "abc", "") == "");
+    CHECK(bs::replace_all(""_sv, "abc", "x") == "");
+
+    SECTION("compare with find and append") {
+        const std::string text = "one <br> two <br><br> three <br> and the last line <br>";
+        std::string expected;
+        std::size_t pos = 0;
+        while (true) {
+            const std::size_t match = text.find("<br>", pos);
+            if (match == std::string::npos) { break; }
+            expected.append(text, pos, match - pos).append("\n");
+            pos = match + 4;
+        }
+        expected.append(text, pos, std::string::npos);
+
+        const bs::string result = bs::replace_all(bs::string_view(text.data(), text.size()), "<br>", "\n");
+        CHECK(bs::string_view(result) == bs::string_view(expected.data(), expected.size()));
+    }
+}
+
+TEST_CASE("replace_all_inplace", "[transform]") {
+    bs::string str = "a,b,,c and some long text, that does not fit, into the small buffer"_s;
+    const auto* const data = str.data();
+
+    bs::replace_all_inplace(str, ',', ';');
+    CHECK(str == "a;b;;c and some long text; that does not fit; into the small buffer");
+    bs::replace_all_inplace(str, ";;", "||");
+    CHECK(str == "a;b||c and some long text; that does not fit; into the small buffer");
+    bs::replace_all_inplace(str, "text", "TEXT"_sv);
+    CHECK(str == "a;b||c and some long TEXT; that does not fit; into the small buffer");
+    CHECK(str.data() == data);
+}
+
+TEST_CASE("translate", "[transform]") {
+    constexpr auto table = bs::make_translation_table("abc"_sv, "ABC"_sv);
+    STATIC_CHECK(table['a'] == 'A');
+    STATIC_CHECK(table['d'] == 'd');
+
+    CHECK(bs::translate("abcd cba"_sv, table) == "ABCd CBA");
+    CHECK(bs::translate(""_sv, table) == "");
+
+    const auto unreserved = bs::make_translation_table("+/=", "-_.");
+    CHECK(bs::translate("aGVsbG8+d29ybGQ/Pz8=", unreserved) == "aGVsbG8-d29ybGQ_Pz8.");
+
+    bs::string str = "\x80\xff high bytes are translated too"_s;
+    std::array<char, 256> to_upper = bs::make_translation_table("", "");
+    for (char ch = 'a'; ch <= 'z'; ++ch) {
+        to_upper[static_cast<unsigned char>(ch)] = static_cast<char>(ch - 'a' + 'A');
+    }
+    to_upper[0xff] = '?';
+    bs::translate_inplace(str, to_upper);
+    CHECK(str == "\x80? HIGH BYTES ARE TRANSLATED TOO");
+}
+
+}
@@ -5,9 +5,20 @@
 
 #pragma once
 #include <betterstring/detail/preprocessor.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
 
+#include <fcntl.h>
 #if BS_OS_WINDOWS
     #include <Windows.h>
+    #include <io.h>
+#else
+    #include <unistd.h>
 #endif
 
 #if BS_OS_WINDOWS
@@ -36,3 +47,52 @@ inline void page_free(void* addr) {
 }
 #endif
 
+// deterministic linear congruential generator, the tests are reproducible across platforms
+struct random_generator {
+    std::size_t next(const std::size_t bound) noexcept {
+        state = state * 1103515245 + 12345;
+        return (state >> 16) % bound;
+    }
+    std::uint32_t state = 42;
+};
+
+// The file "betterstring_<suffix>" in the temporary directory with `content`, removed at the destruction.
+// The file is opened with `open_flags` unless they are `no_open`, on Windows in binary mode.
+struct temporary_file {
+    static constexpr int no_open = -1;
+
+    temporary_file(const std::string& suffix, const std::string& content, const int open_flags = no_open) {
+        path = (std::filesystem::temp_directory_path() / ("betterstring_" + suffix)).string();
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file.write(content.data(), static_cast<std::streamsize>(content.size()));
+        }
+        if (open_flags != no_open) {
+#if BS_OS_WINDOWS
+            fd = ::_open(path.c_str(), open_flags | _O_BINARY);
+#else
+            fd = ::open(path.c_str(), open_flags);
+#endif
+        }
+    }
+    temporary_file(const temporary_file&) = delete;
+    temporary_file& operator=(const temporary_file&) = delete;
+    ~temporary_file() {
+        if (fd != -1) {
+#if BS_OS_WINDOWS
+            ::_close(fd);
+#else
+            ::close(fd);
+#endif
+        }
+        std::remove(path.c_str());
+    }
+
+    std::string content() const {
+        std::ifstream file(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    std::string path;
+    int fd = -1;
+};